@@ -0,0 +1,42 @@
+#include <ipp/scene/scene.hpp>
+#include <ipp/scene/spatial/spatialsystem.hpp>
+#include <ipp/loop/messageloop.hpp>
+#include "capi.hpp"
+
+using namespace std;
+using namespace ipp;
+using namespace ipp::scene;
+using namespace ipp::scene::spatial;
+
+extern "C" {
+
+/**
+ * @brief Return id of closest visible entity under viewport point (-1, 1 range) or 0 if none.
+ * @note distance is written only if an entity was hit, distance may be nullptr.
+ */
+uint32_t IVL_API_EXPORT scene_spatial_pick(Scene* scene, float x, float y, float* distance)
+{
+    auto spatialSystem = scene->getMessageLoop().findSystem<SpatialSystem>();
+    float hitDistance = 0;
+    auto entityId = spatialSystem->pick({x, y}, hitDistance);
+    if (entityId != 0 && distance != nullptr) {
+        *distance = hitDistance;
+    }
+    return entityId;
+}
+
+/**
+ * @brief Write ids of entities whose bounds overlap box (min/max are float[3]) to entityIds.
+ * @return total number of matching entities, only first capacity ids are written
+ */
+uint32_t IVL_API_EXPORT scene_spatial_query_box(
+    Scene* scene, const float* min, const float* max, uint32_t* entityIds, uint32_t capacity)
+{
+    auto spatialSystem = scene->getMessageLoop().findSystem<SpatialSystem>();
+
+    vector<uint32_t> result;
+    spatialSystem->queryBox({glm::make_vec3(min), glm::make_vec3(max)}, result);
+    copy_n(result.begin(), std::min<size_t>(result.size(), capacity), entityIds);
+    return static_cast<uint32_t>(result.size());
+}
+}
@@ -2,6 +2,7 @@
 
 #include <ipp/shared.hpp>
 #include <ipp/resource/resourcemanager.hpp>
+#include <ipp/task/threadpool.hpp>
 #include <ipp/scene/scene.hpp>
 
 namespace ipp {
@@ -9,6 +10,7 @@ namespace ipp {
 class Context final : public NonCopyable {
 private:
     json _configuration;
+    task::ThreadPool _threadPool;
     resource::ResourceManager _resourceManager;
 
 public:
@@ -27,6 +29,17 @@ public:
         return _configuration;
     }
 
+    /**
+     * @brief Context ThreadPool shared by all Scene systems.
+     *
+     * Worker count is read from "task.workerCount" configuration value, if value is missing pool
+     * is serial (0 workers), negative value uses ThreadPool::GetDefaultWorkerCount().
+     */
+    task::ThreadPool& getThreadPool()
+    {
+        return _threadPool;
+    }
+
     /**
      * @brief Context ResourceManager instance.
      */
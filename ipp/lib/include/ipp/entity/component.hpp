@@ -19,12 +19,13 @@ public:
 private:
     static uint32_t ComponentTypeIdCounter;
     Entity& _entity;
+    uint64_t _changeVersion;
 
 public:
-    ComponentBase(Entity& entity)
-        : _entity{entity}
-    {
-    }
+    /**
+     * @brief Construct component, new components are considered changed in current World frame.
+     */
+    ComponentBase(Entity& entity);
 
     virtual ~ComponentBase() = default;
 
@@ -45,6 +46,48 @@ public:
     {
         return _entity;
     }
+
+    /**
+     * @brief World frame in which component was last modified.
+     *
+     * Compare against a previously observed World::getFrame() value to check if component changed
+     * since then (change version is greater or equal to observed frame).
+     */
+    uint64_t getChangeVersion() const
+    {
+        return _changeVersion;
+    }
+
+    /**
+     * @brief Size of component state captured by WorldSnapshot, 0 if component isn't captured.
+     * @note Size must not change while World structure stays the same.
+     */
+    virtual size_t getSnapshotSize() const
+    {
+        return 0;
+    }
+
+    /**
+     * @brief Copy component state in to getSnapshotSize() bytes of snapshot buffer.
+     */
+    virtual void writeSnapshot(uint8_t* buffer) const
+    {
+    }
+
+    /**
+     * @brief Restore component state from buffer written by writeSnapshot.
+     */
+    virtual void readSnapshot(const uint8_t* buffer)
+    {
+    }
+
+    /**
+     * @brief Set component change version to current World frame.
+     *
+     * Called by component mutable accessors, call explicitly after modifying component state
+     * trough a previously obtained reference.
+     */
+    void markDirty();
 };
 
 /**
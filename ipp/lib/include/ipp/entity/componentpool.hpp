@@ -0,0 +1,160 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/noncopyable.hpp>
+#include "component.hpp"
+
+namespace ipp {
+namespace entity {
+
+/**
+ * @brief Type erased interface for ComponentPoolT, used by Entity to release Components.
+ */
+class ComponentPoolBase : public NonCopyable {
+public:
+    /**
+     * @brief Pool memory usage snapshot.
+     */
+    struct Statistics {
+        /**
+         * @brief Pooled Component implementation type name.
+         */
+        std::string componentTypeName;
+
+        /**
+         * @brief Number of Component instances currently allocated from pool.
+         */
+        size_t liveCount;
+
+        /**
+         * @brief Number of Component slots in all allocated slabs.
+         */
+        size_t capacity;
+
+        /**
+         * @brief Bytes allocated for slabs.
+         */
+        size_t bytes;
+    };
+
+    virtual ~ComponentPoolBase() = default;
+
+    /**
+     * @brief Destroy Component instance allocated by this pool and return it's slot to free list.
+     */
+    virtual void destroy(ComponentBase* component) = 0;
+
+    /**
+     * @brief Current pool usage statistics.
+     */
+    virtual Statistics getStatistics() const = 0;
+};
+
+/**
+ * @brief Pool allocator for Component type T.
+ *
+ * Components are constructed in place in fixed size slabs, released slots are kept in an
+ * intrusive free list and reused (most recently released first). Slabs are never freed until
+ * pool is destroyed so creating/removing components in steady state does not touch the heap.
+ */
+template <typename T>
+class ComponentPoolT final : public ComponentPoolBase {
+public:
+    /**
+     * @brief Number of Component slots allocated per slab.
+     */
+    static constexpr size_t SlabSize = 64;
+
+private:
+    union Slot {
+        Slot* next;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> _slabs;
+    Slot* _freeList;
+    size_t _liveCount;
+
+    /**
+     * @brief Allocate a new slab and link all of it's slots in to free list.
+     */
+    void allocateSlab()
+    {
+        std::unique_ptr<Slot[]> slab{new Slot[SlabSize]};
+        for (size_t i = 0; i < SlabSize; ++i) {
+            slab[i].next = i + 1 < SlabSize ? &slab[i + 1] : _freeList;
+        }
+        _freeList = &slab[0];
+        _slabs.push_back(std::move(slab));
+    }
+
+public:
+    ComponentPoolT()
+        : _freeList{nullptr}
+        , _liveCount{0}
+    {
+    }
+
+    ~ComponentPoolT()
+    {
+        // all components must be released by their entities before World destroys pools
+        assert(_liveCount == 0);
+    }
+
+    /**
+     * @brief Construct a new T instance in a free pool slot.
+     */
+    template <typename... Params>
+    T* create(Entity& entity, Params&&... params)
+    {
+        if (_freeList == nullptr) {
+            allocateSlab();
+        }
+
+        auto slot = _freeList;
+        _freeList = slot->next;
+
+        T* component;
+        try {
+            component = new (&slot->storage) T(entity, std::forward<Params>(params)...);
+        }
+        catch (...) {
+            slot->next = _freeList;
+            _freeList = slot;
+            throw;
+        }
+
+        _liveCount++;
+        return component;
+    }
+
+    /**
+     * @brief Destroy component and return it's slot to free list.
+     */
+    void destroy(ComponentBase* component) override
+    {
+        assert(component->getComponentTypeId() == T::GetComponentTypeId());
+
+        auto instance = static_cast<T*>(component);
+        instance->~T();
+
+        auto slot = reinterpret_cast<Slot*>(instance);
+        slot->next = _freeList;
+        _freeList = slot;
+        _liveCount--;
+    }
+
+    /**
+     * @brief Current pool usage statistics.
+     */
+    Statistics getStatistics() const override
+    {
+        auto capacity = _slabs.size() * SlabSize;
+        return {T::ComponentTypeName, _liveCount, capacity, capacity * sizeof(Slot)};
+    }
+};
+
+template <typename T>
+constexpr size_t ComponentPoolT<T>::SlabSize;
+}
+}
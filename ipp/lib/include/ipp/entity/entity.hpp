@@ -17,7 +17,7 @@ private:
     World& _world;
     const uint32_t _id;
     const std::string _name;
-    std::vector<std::unique_ptr<ComponentBase>> _componentBuffer;
+    std::vector<ComponentBase*> _componentBuffer;
 
     void dispatchComponentsModified();
 
@@ -30,25 +30,16 @@ public:
     }
 
     /**
-     * @brief Create a new component of type T.
+     * @brief Release all Components back to World component pools.
      */
-    template <typename T, typename... Params>
-    T* createComponent(Params&&... params)
-    {
-        auto componentTypeId = T::GetComponentTypeId();
-
-        if (findComponent<T>()) {
-            IVL_LOG_THROW_ERROR(std::runtime_error,
-                                "Entity {} already contains required Component type {}", _name,
-                                componentTypeId);
-        }
+    ~Entity();
 
-        auto component = std::make_unique<T>(*this, std::forward<Params>(params)...);
-        auto result = component.get();
-        _componentBuffer.push_back(std::move(component));
-        dispatchComponentsModified();
-        return result;
-    }
+    /**
+     * @brief Create a new component of type T allocated from World ComponentPoolT<T>.
+     * @note Defined in world.hpp, World must be a complete type to allocate from it's pools.
+     */
+    template <typename T, typename... Params>
+    T* createComponent(Params&&... params);
 
     /**
      * @brief Find Component of type T in Entity or nullptr if no Component found.
@@ -105,7 +96,7 @@ public:
     /**
      * @brief Buffer used to store entity components.
      */
-    const std::vector<std::unique_ptr<ComponentBase>>& getComponentBuffer() const
+    const std::vector<ComponentBase*>& getComponentBuffer() const
     {
         return _componentBuffer;
     }
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/noncopyable.hpp>
+#include <atomic>
+#include "entity.hpp"
+
+namespace ipp {
+namespace entity {
+
+/**
+ * @brief Records structural World changes to be applied later at a safe synchronization point.
+ *
+ * Creating/removing entities or components while an EntityGroup is being iterated invalidates
+ * group entity vectors, systems record such changes in a command buffer instead and World applies
+ * them (in recording order) once no system is iterating.
+ *
+ * Entities are referenced by id so components can be added to entities created earlier in the
+ * same buffer.
+ *
+ * Commands are numbered from sequence counter shared by buffers of the same World so commands
+ * recorded in to different buffers are applied together in the order they were recorded in,
+ * regardless of the order buffers were created in.
+ *
+ * @note Command buffer is not thread safe, use World::getCommandBuffer to get a per thread buffer.
+ */
+class EntityCommandBuffer final : public NonCopyable {
+private:
+    enum class CommandKind { CreateEntity, RemoveEntity, CreateComponent, RemoveComponent };
+
+    struct Command {
+        CommandKind kind;
+        uint64_t sequence;
+        uint32_t entityId;
+        uint32_t componentTypeId;
+        std::string entityName;
+        std::function<void(Entity&)> createComponent;
+    };
+
+    std::atomic<uint64_t>* _sequenceCounter;
+    std::vector<Command> _commands;
+
+    /**
+     * @brief Sequence number of next recorded command.
+     */
+    uint64_t nextSequence()
+    {
+        return _sequenceCounter != nullptr ? (*_sequenceCounter)++ : _commands.size();
+    }
+
+    /**
+     * @brief Apply single recorded command to World.
+     */
+    static void applyCommand(World& world, Command& command);
+
+public:
+    /**
+     * @brief Create command buffer numbering commands from sequenceCounter (or in recording order
+     *        if nullptr).
+     */
+    explicit EntityCommandBuffer(std::atomic<uint64_t>* sequenceCounter = nullptr)
+        : _sequenceCounter{sequenceCounter}
+    {
+    }
+
+    /**
+     * @brief Record World::createEntity command.
+     */
+    void createEntity(uint32_t id, std::string name)
+    {
+        _commands.push_back(
+            {CommandKind::CreateEntity, nextSequence(), id, 0, std::move(name), nullptr});
+    }
+
+    /**
+     * @brief Record World::removeEntity command.
+     */
+    void removeEntity(uint32_t id)
+    {
+        _commands.push_back({CommandKind::RemoveEntity, nextSequence(), id, 0, {}, nullptr});
+    }
+
+    /**
+     * @brief Record Entity::createComponent<T> command, component parameters are copied.
+     */
+    template <typename T, typename... Params>
+    void createComponent(uint32_t entityId, Params... params)
+    {
+        _commands.push_back({CommandKind::CreateComponent, nextSequence(), entityId,
+                             T::GetComponentTypeId(), {}, [params...](Entity& entity) {
+                                 entity.createComponent<T>(params...);
+                             }});
+    }
+
+    /**
+     * @brief Record Entity::removeComponent command for Component type T.
+     */
+    template <typename T>
+    void removeComponent(uint32_t entityId)
+    {
+        _commands.push_back({CommandKind::RemoveComponent, nextSequence(), entityId,
+                             T::GetComponentTypeId(), {}, nullptr});
+    }
+
+    /**
+     * @brief Apply recorded commands to World in recording order and clear buffer.
+     *
+     * Commands referencing entities/components that no longer exist and commands that fail (eg.
+     * duplicate entity id) are logged and skipped, remaining commands are still applied.
+     */
+    void apply(World& world);
+
+    /**
+     * @brief Apply commands recorded in buffers to World ordered by sequence number and clear
+     *        buffers (see apply).
+     */
+    static void apply(World& world, const std::vector<EntityCommandBuffer*>& buffers);
+
+    /**
+     * @brief Number of recorded commands.
+     */
+    size_t size() const
+    {
+        return _commands.size();
+    }
+
+    /**
+     * @brief Has any command been recorded.
+     */
+    bool isEmpty() const
+    {
+        return _commands.empty();
+    }
+};
+}
+}
@@ -27,6 +27,23 @@ class EntityGroupWithFilter : public WorldEntityObserver {
 private:
     std::vector<std::tuple<Entity*, ComponentTypes*...>> _entities;
 
+    /**
+     * @brief Check if any group component in entity tuple changed since version.
+     */
+    template <size_t... Indices>
+    static bool IsChangedSince(const std::tuple<Entity*, ComponentTypes*...>& components,
+                               uint64_t version,
+                               std::index_sequence<Indices...>)
+    {
+        auto isChanged = [version](const auto* component) {
+            return component != nullptr && component->getChangeVersion() >= version;
+        };
+        bool changed = false;
+        (void)std::initializer_list<int>{
+            (changed = changed || isChanged(std::get<Indices + 1>(components)), 0)...};
+        return changed;
+    }
+
     /**
      * @brief Called by onEntityComponentUpdate when entity gets added to entity group.
      */
@@ -103,6 +120,23 @@ public:
         return _entities;
     }
 
+    /**
+     * @brief Invoke function for every group entity tuple with a component changed since version.
+     *
+     * Version is a World::getFrame() value, systems typically store the frame value at the end of
+     * their update and pass it in next update to process only modified entities.
+     */
+    template <typename Function>
+    void forEachChangedSince(uint64_t version, Function&& function) const
+    {
+        for (auto& components : _entities) {
+            if (IsChangedSince(components, version,
+                               std::index_sequence_for<ComponentTypes...>{})) {
+                function(components);
+            }
+        }
+    }
+
     /**
      * @brief Owning World object.
      */
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/noncopyable.hpp>
+#include "entity.hpp"
+
+namespace ipp {
+namespace entity {
+
+/**
+ * @brief Paged Entity container with O(1) id lookup and contiguous iteration.
+ *
+ * Entity objects are constructed in place inside fixed size pages and never move, so Entity
+ * references stay valid until the Entity is removed. Removed slots are reused by new entities.
+ *
+ * Ids are mapped to dense indices trough a lazily allocated paged sparse array (ids exported by
+ * the pipeline are small dense integers so the sparse array stays compact). Dense array holds
+ * Entity pointers in creation order and is used for iteration.
+ *
+ * @note Removing an Entity moves the last dense Entity in to removed position (swap-remove),
+ *       iteration order is not preserved across removals.
+ */
+class EntityStorage final : public NonCopyable {
+public:
+    /**
+     * @brief Number of Entity objects allocated per page.
+     */
+    static constexpr size_t EntityPageSize = 256;
+
+    /**
+     * @brief Number of id entries in a single sparse index page.
+     */
+    static constexpr size_t IndexPageSize = 1024;
+
+private:
+    typedef std::aligned_storage<sizeof(Entity), alignof(Entity)>::type EntitySlot;
+
+    std::vector<std::unique_ptr<EntitySlot[]>> _entityPages;
+    std::vector<EntitySlot*> _freeSlots;
+    size_t _lastPageUsed;
+    std::vector<std::unique_ptr<uint32_t[]>> _indexPages;
+    std::vector<Entity*> _entities;
+
+    /**
+     * @brief Return a pointer to dense index slot for id (dense index + 1, 0 if empty).
+     * @return nullptr if index page for id has not been allocated
+     */
+    uint32_t* findIndexSlot(uint32_t id) const
+    {
+        auto page = id / IndexPageSize;
+        if (page >= _indexPages.size() || !_indexPages[page]) {
+            return nullptr;
+        }
+        return &_indexPages[page][id % IndexPageSize];
+    }
+
+    /**
+     * @brief Return a pointer to dense index slot for id, allocating index page if needed.
+     */
+    uint32_t& requireIndexSlot(uint32_t id);
+
+    /**
+     * @brief Return uninitialized storage for a new Entity object.
+     */
+    EntitySlot* allocateSlot();
+
+public:
+    EntityStorage();
+    ~EntityStorage();
+
+    /**
+     * @brief Construct a new Entity in storage.
+     * @note Caller must ensure no Entity with same id exists in storage.
+     */
+    Entity* create(World& world, uint32_t id, std::string name);
+
+    /**
+     * @brief Destroy Entity with id and release it's storage slot.
+     * @return false if entity with id not found, true otherwise
+     */
+    bool remove(uint32_t id);
+
+    /**
+     * @brief Find Entity with id or nullptr if no such Entity exists.
+     */
+    Entity* find(uint32_t id) const
+    {
+        auto slot = findIndexSlot(id);
+        if (slot == nullptr || *slot == 0) {
+            return nullptr;
+        }
+        return _entities[*slot - 1];
+    }
+
+    /**
+     * @brief Number of entities in storage.
+     */
+    size_t size() const
+    {
+        return _entities.size();
+    }
+
+    /**
+     * @brief Number of Entity slots allocated (used + free).
+     */
+    size_t capacity() const
+    {
+        return _entityPages.size() * EntityPageSize;
+    }
+
+    /**
+     * @brief Dense array of Entity pointers.
+     */
+    const std::vector<Entity*>& getEntities() const
+    {
+        return _entities;
+    }
+
+    std::vector<Entity*>::const_iterator begin() const
+    {
+        return _entities.begin();
+    }
+
+    std::vector<Entity*>::const_iterator end() const
+    {
+        return _entities.end();
+    }
+};
+}
+}
@@ -3,7 +3,12 @@
 #include <ipp/shared.hpp>
 #include <ipp/noncopyable.hpp>
 #include <ipp/loop/messageloop.hpp>
+#include <mutex>
+#include <thread>
 #include "entity.hpp"
+#include "entitycommandbuffer.hpp"
+#include "componentpool.hpp"
+#include "entitystorage.hpp"
 #include "entityfilter.hpp"
 #include "worldentityobserver.hpp"
 
@@ -18,9 +23,16 @@ public:
     friend class Entity;
 
 private:
-    std::unordered_map<uint32_t, std::unique_ptr<Entity>> _entities;
+    // component pools must outlive entities and are declared first
+    std::vector<std::unique_ptr<ComponentPoolBase>> _componentPools;
+    EntityStorage _entities;
     std::vector<std::unique_ptr<WorldEntityObserver>> _entityObservers;
     uint32_t _maxEntityId;
+    uint64_t _frame;
+    uint64_t _structureVersion;
+    std::mutex _commandBuffersMutex;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<EntityCommandBuffer>>> _commandBuffers;
+    std::atomic<uint64_t> _commandSequence;
 
     /**
      * @brief Called by Entity to notify parent World that it's Components have been updated.
@@ -30,9 +42,36 @@ private:
 public:
     World()
         : _maxEntityId{0}
+        , _frame{0}
+        , _structureVersion{0}
+        , _commandSequence{0}
     {
     }
 
+    /**
+     * @brief Current World frame, used as Component change version.
+     */
+    uint64_t getFrame() const
+    {
+        return _frame;
+    }
+
+    /**
+     * @brief Version incremented every time an Entity or Component is created or removed.
+     */
+    uint64_t getStructureVersion() const
+    {
+        return _structureVersion;
+    }
+
+    /**
+     * @brief Start a new World frame, called by owner once per update.
+     */
+    void advanceFrame()
+    {
+        _frame++;
+    }
+
     /**
      * @brief Create a new Entity object with a unique id and name string.
      */
@@ -49,13 +88,7 @@ public:
      */
     Entity* findEntity(uint32_t id) const
     {
-        auto entityIt = _entities.find(id);
-        if (entityIt == _entities.end()) {
-            return nullptr;
-        }
-        else {
-            return entityIt->second.get();
-        }
+        return _entities.find(id);
     }
 
     /**
@@ -75,9 +108,9 @@ public:
     {
         auto observer = std::make_unique<T>(*this, std::forward<Params>(params)...);
 
-        for (auto& entity : _entities) {
+        for (auto entity : _entities) {
             auto ptr = static_cast<entity::WorldEntityObserver*>(observer.get());
-            ptr->onEntityComponentsModified(*entity.second);
+            ptr->onEntityComponentsModified(*entity);
         }
 
         auto result = observer.get();
@@ -100,11 +133,12 @@ public:
     }
 
     /**
-     * @brief Entity collection indexed by Entity Id.
+     * @brief Dense array of World Entity pointers.
+     * @note Order is not preserved when entities are removed.
      */
-    const std::unordered_map<uint32_t, std::unique_ptr<Entity>>& getEntities() const
+    const std::vector<Entity*>& getEntities() const
     {
-        return _entities;
+        return _entities.getEntities();
     }
 
     /**
@@ -115,9 +149,9 @@ public:
     std::vector<Entity*> filterEntities() const
     {
         std::vector<Entity*> result;
-        for (auto& entity : _entities) {
-            if (EntityFilter::match(*entity.second)) {
-                result.push_back(entity.second.get());
+        for (auto entity : _entities) {
+            if (EntityFilter::match(*entity)) {
+                result.push_back(entity);
             }
         }
         return result;
@@ -130,9 +164,9 @@ public:
     std::vector<Entity*> filterEntitiesWithComponents() const
     {
         std::vector<Entity*> result;
-        for (auto& entity : _entities) {
-            if (ContainsAllComponents<ComponentTypes...>::match(*entity.second)) {
-                result.push_back(entity.second.get());
+        for (auto entity : _entities) {
+            if (ContainsAllComponents<ComponentTypes...>::match(*entity)) {
+                result.push_back(entity);
             }
         }
         return result;
@@ -145,6 +179,79 @@ public:
     {
         return _entityObservers;
     }
+
+    /**
+     * @brief Pool used to allocate Components of type T, created on first use.
+     */
+    template <typename T>
+    ComponentPoolT<T>& getComponentPool()
+    {
+        auto componentTypeId = T::GetComponentTypeId();
+        if (componentTypeId >= _componentPools.size()) {
+            _componentPools.resize(componentTypeId + 1);
+        }
+
+        auto& pool = _componentPools[componentTypeId];
+        if (!pool) {
+            pool = std::make_unique<ComponentPoolT<T>>();
+        }
+        return static_cast<ComponentPoolT<T>&>(*pool);
+    }
+
+    /**
+     * @brief Pool for Component type with componentTypeId or nullptr if pool wasn't created.
+     */
+    ComponentPoolBase* findComponentPool(uint32_t componentTypeId) const
+    {
+        if (componentTypeId >= _componentPools.size()) {
+            return nullptr;
+        }
+        return _componentPools[componentTypeId].get();
+    }
+
+    /**
+     * @brief EntityCommandBuffer for calling thread, created on first use.
+     *
+     * Use to defer structural changes while systems iterate entity groups (also from worker
+     * threads), commands are applied by applyCommandBuffers.
+     */
+    EntityCommandBuffer& getCommandBuffer();
+
+    /**
+     * @brief Apply and clear commands recorded in all thread command buffers, commands of all
+     *        buffers are applied in the order they were recorded in.
+     * @note Must be called when no other thread is recording commands (MessageLoop sync point).
+     */
+    void applyCommandBuffers();
+
+    /**
+     * @brief Usage statistics for every Component type pool created by World.
+     */
+    std::vector<ComponentPoolBase::Statistics> getComponentPoolStatistics() const;
 };
+
+template <typename T, typename... Params>
+T* Entity::createComponent(Params&&... params)
+{
+    auto componentTypeId = T::GetComponentTypeId();
+
+    if (findComponent<T>()) {
+        IVL_LOG_THROW_ERROR(std::runtime_error,
+                            "Entity {} already contains required Component type {}", _name,
+                            componentTypeId);
+    }
+
+    auto& pool = _world.getComponentPool<T>();
+    auto result = pool.create(*this, std::forward<Params>(params)...);
+    try {
+        _componentBuffer.push_back(result);
+    }
+    catch (...) {
+        pool.destroy(result);
+        throw;
+    }
+    dispatchComponentsModified();
+    return result;
+}
 }
 }
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+
+namespace ipp {
+namespace entity {
+
+/**
+ * @brief Contiguous copy of World Component state used to checkpoint and restore a World.
+ *
+ * Components opt in to snapshots by overriding ComponentBase snapshot methods. Snapshot is stored
+ * as a single byte buffer in World entity/component order, restoring is only valid while World
+ * structure (entities and their components) stays the same as when snapshot was captured.
+ *
+ * @note Capturing in to an existing snapshot reuses it's buffer so periodic checkpoints do not
+ *       allocate once buffer capacity is reached.
+ */
+class WorldSnapshot final {
+private:
+    std::vector<uint8_t> _buffer;
+    uint64_t _structureVersion;
+    const World* _world;
+
+public:
+    WorldSnapshot();
+
+    /**
+     * @brief Copy state of all World snapshot components in to snapshot buffer.
+     */
+    void capture(const World& world);
+
+    /**
+     * @brief Copy snapshot buffer state back in to World components (and mark them dirty).
+     * @throws std::logic_error if world is not the captured World or it's structure changed
+     */
+    void restore(World& world) const;
+
+    /**
+     * @brief Check if snapshot can be restored in to World.
+     */
+    bool isValidFor(const World& world) const;
+
+    /**
+     * @brief Snapshot buffer size in bytes.
+     */
+    size_t getSize() const
+    {
+        return _buffer.size();
+    }
+};
+}
+}
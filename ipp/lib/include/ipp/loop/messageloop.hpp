@@ -49,6 +49,7 @@ private:
     std::unique_ptr<std::vector<std::unique_ptr<Message>>> _messageQueueActive;
     std::unique_ptr<std::vector<std::unique_ptr<Message>>> _messageQueueProcessing;
     std::vector<std::unique_ptr<EventListener>> _eventListeners;
+    std::vector<std::function<void()>> _syncCallbacks;
     std::vector<std::unique_ptr<Command::Factory>> _commandFactories;
     std::vector<std::string> _messageTypeNames;
 
@@ -179,6 +180,19 @@ public:
      */
     void releaseListener(EventListener* listener);
 
+    /**
+     * @brief Add a callback invoked at every MessageLoop synchronization point.
+     *
+     * Synchronization points are after queued messages are dispatched and after every System
+     * update, callbacks are used to apply deferred changes (eg. World entity command buffers).
+     */
+    void registerSyncCallback(std::function<void()> callback);
+
+    /**
+     * @brief Invoke all sync callbacks.
+     */
+    void synchronize();
+
     /**
      * @brief Immediately dispatch a Event Message.
      *
@@ -23,6 +23,11 @@ public:
 
             operator glm::mat4() const;
 
+            /**
+             * @brief Compose count pose matrices (same result as operator mat4) in batches.
+             */
+            static void ComposeMatrices(const Pose* poses, size_t count, glm::mat4* matrices);
+
             glm::vec3 translation;
             glm::quat rotation;
             float scale;
@@ -46,6 +46,8 @@ private:
     gl::ArrayBuffer _vertexBuffer;
     gl::ElementArrayBuffer _indexBuffer;
     uint32_t _triangleCount;
+    glm::vec3 _boundsMin;
+    glm::vec3 _boundsMax;
 
 public:
     Mesh(std::unique_ptr<resource::ResourceBuffer> data);
@@ -86,6 +88,22 @@ public:
     {
         return _triangleCount;
     }
+
+    /**
+     * @brief Minimum corner of object space vertex position bounding box.
+     */
+    const glm::vec3& getBoundsMin() const
+    {
+        return _boundsMin;
+    }
+
+    /**
+     * @brief Maximum corner of object space vertex position bounding box.
+     */
+    const glm::vec3& getBoundsMax() const
+    {
+        return _boundsMax;
+    }
 };
 }
 }
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IPP_TRANSFORM_KERNEL_SSE
+#endif
+
+namespace ipp {
+namespace render {
+
+/**
+ * @brief Write translation * rotation * scale matrix from rotation matrix columns.
+ *
+ * Output is column major and matches the product of glm translate/rotation/scale matrices.
+ */
+inline void composeTransformMatrix(const glm::vec3& translation,
+                                   const glm::vec3& rotationColumnX,
+                                   const glm::vec3& rotationColumnY,
+                                   const glm::vec3& rotationColumnZ,
+                                   const glm::vec3& scale,
+                                   glm::mat4& matrix)
+{
+    matrix[0] = glm::vec4(rotationColumnX * scale.x, 0.0f);
+    matrix[1] = glm::vec4(rotationColumnY * scale.y, 0.0f);
+    matrix[2] = glm::vec4(rotationColumnZ * scale.z, 0.0f);
+    matrix[3] = glm::vec4(translation, 1.0f);
+}
+
+/**
+ * @brief Write translation * rotation * scale matrix for quaternion rotation.
+ *
+ * Quaternion is not normalized (same as glm::toMat4).
+ */
+inline void composeQuaternionTransformMatrix(const glm::vec3& translation,
+                                             const glm::quat& rotation,
+                                             const glm::vec3& scale,
+                                             glm::mat4& matrix)
+{
+    float xx = rotation.x * rotation.x, yy = rotation.y * rotation.y, zz = rotation.z * rotation.z;
+    float xy = rotation.x * rotation.y, xz = rotation.x * rotation.z, yz = rotation.y * rotation.z;
+    float wx = rotation.w * rotation.x, wy = rotation.w * rotation.y, wz = rotation.w * rotation.z;
+
+    composeTransformMatrix(
+        translation, glm::vec3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy)),
+        glm::vec3(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)),
+        glm::vec3(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)), scale, matrix);
+}
+
+/**
+ * @brief Write 4 translation * quaternion rotation * scale matrices at once.
+ *
+ * Uses SSE (4 transforms per register) when available, scalar kernel otherwise.
+ */
+void composeQuaternionTransformMatrices4(const glm::vec3 translations[4],
+                                         const glm::quat rotations[4],
+                                         const glm::vec3 scales[4],
+                                         glm::mat4 matrices[4]);
+}
+}
@@ -29,10 +29,12 @@ public:
 
     /**
      * @param packageResourcePath package relative resource path (no package prefix)
+     * @param retained resource data is kept alive by requester rather than copied and released,
+     *        packages can map retained data instead of reading it
      * @return Resource data buffer for resource at specified path.
      */
     virtual std::unique_ptr<ResourceBuffer> requestResourceData(
-        const std::string& packageResourcePath) = 0;
+        const std::string& packageResourcePath, bool retained) = 0;
 
     /**
      * @brief Owning ResourceManager object.
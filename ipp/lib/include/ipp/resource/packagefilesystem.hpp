@@ -20,9 +20,10 @@ public:
     PackageFileSystem(ResourceManager& resourceManager, std::string name, std::string rootPath);
 
     /**
-     * @brief Read resource data.
+     * @brief Read resource data, retained resource data is memory mapped where supported.
      */
-    std::unique_ptr<ResourceBuffer> requestResourceData(const std::string& resourcePath) override;
+    std::unique_ptr<ResourceBuffer> requestResourceData(const std::string& resourcePath,
+                                                        bool retained) override;
 
     /**
      * @brief Package root folder path (absolute).
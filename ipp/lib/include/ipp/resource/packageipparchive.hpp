@@ -35,8 +35,11 @@ public:
 
     /**
      * @brief Create ResourceBuffer from resourcePath by reading the data to memory from Archive.
+     *
+     * Retained resource data aligned in archive is memory mapped where supported.
      */
-    std::unique_ptr<ResourceBuffer> requestResourceData(const std::string& resourcePath) override;
+    std::unique_ptr<ResourceBuffer> requestResourceData(const std::string& resourcePath,
+                                                        bool retained) override;
 };
 }
 }
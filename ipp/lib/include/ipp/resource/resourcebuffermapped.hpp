@@ -0,0 +1,54 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include "resourcebuffer.hpp"
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#define IPP_RESOURCE_BUFFER_MAPPED
+#endif
+
+namespace ipp {
+namespace resource {
+
+#ifdef IPP_RESOURCE_BUFFER_MAPPED
+/**
+ * @brief ResourceBuffer that memory maps a read-only range of a file.
+ *
+ * Pages are loaded on demand and shared with the OS file cache, so resources that are kept alive
+ * after loading (eg. scene animation data evaluated directly from the buffer) only occupy memory
+ * for pages that are actually used.
+ */
+class ResourceBufferMapped final : public ResourceBuffer {
+private:
+    void* _mapping;
+    size_t _mappingSize;
+    const char* _data;
+    size_t _size;
+
+    /**
+     * @brief Map _size bytes of open file starting at offset and close file.
+     */
+    void map(int file, const std::string& filePath, size_t offset);
+
+public:
+    /**
+     * @brief Map whole file at file path.
+     */
+    ResourceBufferMapped(Package& package, std::string resourcePath, const std::string& filePath);
+
+    /**
+     * @brief Map size bytes of file at file path starting at offset.
+     */
+    ResourceBufferMapped(Package& package,
+                         std::string resourcePath,
+                         const std::string& filePath,
+                         size_t offset,
+                         size_t size);
+    ~ResourceBufferMapped() override;
+
+    const char* getData(size_t offset = 0, size_t length = 0) override;
+    size_t getSize() const override;
+};
+#endif
+}
+}
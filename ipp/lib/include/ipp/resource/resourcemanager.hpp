@@ -38,8 +38,12 @@ public:
 
     /**
      * @brief Request resource data from specified resource path.
+     *
+     * Retained data is kept alive by requester (eg. Scene data evaluated in place), see
+     * Package::requestResourceData.
      */
-    std::unique_ptr<ResourceBuffer> requestResourceData(const std::string& resourcePath) const;
+    std::unique_ptr<ResourceBuffer> requestResourceData(const std::string& resourcePath,
+                                                        bool retained = false) const;
 
     /**
      * @brief Get a shared resource by fully qualified resource path.
@@ -23,7 +23,20 @@ public:
     {
     }
 
-    void updateTarget(Milliseconds time, Channel::Target target) const;
+    /**
+     * @brief Bind Action channels to target.
+     */
+    void bind(Channel::Target target) const;
+
+    /**
+     * @brief Update bound target to Action state at time specified.
+     */
+    void updateTarget(Milliseconds time) const;
+
+    /**
+     * @brief Reset Action channels state cached by previous updates.
+     */
+    void reset() const;
 
     int getId() const
     {
@@ -2,11 +2,14 @@
 
 #include <ipp/shared.hpp>
 #include <ipp/loop/system.hpp>
+#include <ipp/entity/worldentityobserver.hpp>
 #include <ipp/schema/primitive_generated.h>
 #include <ipp/schema/message/animation_generated.h>
 #include "action.hpp"
 #include "track.hpp"
 #include "sequence.hpp"
+#include "entitysequencegroups.hpp"
+#include "evaluationscheduler.hpp"
 
 namespace ipp {
 namespace scene {
@@ -14,6 +17,21 @@ namespace animation {
 
 /**
  * @brief Animation system controls Scene state by sequencing animation Actions.
+ *
+ * Scene sequence is updated on loop thread first so its side effects (commands) are enqueued in
+ * the same order as before. Entity sequences are grouped by target entity and groups are updated
+ * in parallel on ThreadPool (see EntitySequenceGroups).
+ *
+ * Entity sequence groups that target renderable or skinning armature entities are throttled with
+ * visibility and screen size RenderSystem recorded in the previous frame (see
+ * EvaluationScheduler), configured by "animation" section of Context configuration. Off screen
+ * groups that move renderables are still evaluated at maximum update interval so they can come in
+ * to view. Groups with discrete channels and groups of other entities (cameras, parent nodes) are
+ * updated every frame. Every group skipped by throttling is evaluated when play end is reached
+ * or playback is stopped.
+ * Sequences already evaluated at current animation time are not evaluated again and
+ * StateUpdatedEvent is dispatched on status changes and at most once per "stateEventInterval"
+ * milliseconds of "animation" configuration section while time changes.
  */
 class AnimationSystem final : public loop::SystemT<AnimationSystem> {
 public:
@@ -49,15 +67,34 @@ public:
     typedef loop::CommandT<Stop> StopCommand;
 
     /**
-     * @brief Event dispatched on update after every animation state update (time or status).
+     * @brief Event dispatched with current time on animation status change and while time
+     *        changes at configured rate.
      */
     typedef loop::EventT<ipp::schema::message::animation::AnimationState> StateUpdatedEvent;
 
 private:
+    /**
+     * @brief Rebinds entity sequence channels when target entity components change.
+     */
+    class AnimationEntityObserver final : public entity::WorldEntityObserver {
+    private:
+        AnimationSystem& _animationSystem;
+
+        void onEntityComponentsModified(entity::Entity& entity) override;
+
+    public:
+        AnimationEntityObserver(entity::World& world, AnimationSystem& animationSystem);
+    };
+
     Scene& _scene;
+    task::ThreadPool& _threadPool;
 
     SceneSequence _sceneSequence;
-    std::vector<EntitySequence> _entitySequences;
+    EntitySequenceGroups _entitySequenceGroups;
+    EvaluationScheduler _scheduler;
+    render::RenderSystem* _renderSystem;
+    bool _evaluateAll;
+    bool _evaluateStale;
 
     Milliseconds _playStart;
     Milliseconds _playEnd;
@@ -65,6 +102,14 @@ private:
     Milliseconds _duration;
     Status _status;
 
+    Milliseconds _evaluatedTime;
+    size_t _evaluatedSequenceCount;
+
+    Milliseconds _stateEventInterval;
+    std::chrono::steady_clock::time_point _dispatchedStateClock;
+    Milliseconds _dispatchedTime;
+    Status _dispatchedStatus;
+
     /**
      * @brief System initialization implementation.
      */
@@ -85,6 +130,16 @@ private:
      */
     void onTimeUpdate(Milliseconds deltaTime);
 
+    /**
+     * @brief Dispatch StateUpdatedEvent with current time and status.
+     */
+    void dispatchStateUpdated();
+
+    /**
+     * @brief Mark entity sequence groups throttled by RenderSystem visibility of their targets.
+     */
+    void throttleEntitySequenceGroups();
+
     /**
      * @brief System update implemntation.
      */
@@ -92,11 +147,21 @@ private:
 
 public:
     AnimationSystem(loop::MessageLoop& loop,
+                    task::ThreadPool& threadPool,
                     Scene& scene,
                     SceneSequence&& sceneSequence,
                     std::vector<EntitySequence> entitySequences,
                     Milliseconds duration);
 
+    /**
+     * @brief Reset sequence channels state cached by previous updates.
+     *
+     * Must be called when animated Scene state is changed outside of animation updates (eg.
+     * restoring Scene checkpoint) so next update writes current animation state, next update
+     * also evaluates every entity sequence.
+     */
+    void reset();
+
     /**
      * @brief Owning Scene object.
      */
@@ -121,6 +186,22 @@ public:
         return _duration;
     }
 
+    /**
+     * @brief Number of sequences (scene and entity) evaluated by last update.
+     */
+    size_t getEvaluatedSequenceCount() const
+    {
+        return _evaluatedSequenceCount;
+    }
+
+    /**
+     * @brief Scheduler that throttles entity sequence group updates.
+     */
+    const EvaluationScheduler& getScheduler() const
+    {
+        return _scheduler;
+    }
+
     /**
      * @brief Current animation status.
      */
@@ -64,57 +64,141 @@ public:
     virtual ~Channel() = default;
 
     /**
-     * @brief Update specified target to animation value at time specified.
+     * @brief Resolve target state written by channel.
+     *
+     * Called when channel is loaded and again when target components are replaced, channel
+     * updates don't look up target components.
      */
-    virtual void updateTarget(Milliseconds time, Target target) = 0;
+    virtual void bind(Target target) = 0;
+
+    /**
+     * @brief Update bound target to animation value at time specified.
+     */
+    virtual void updateTarget(Milliseconds time) = 0;
+
+    /**
+     * @brief Discard target state cached by previous updates so next update writes target.
+     *
+     * Called when target could have been changed by something other than this channel (play,
+     * switching track strips or restoring scene state).
+     */
+    virtual void reset()
+    {
+    }
+
+    /**
+     * @brief Does channel write discrete state other systems depend on (visibility, active camera).
+     *
+     * Targets of discrete channels are never throttled by AnimationSystem.
+     */
+    virtual bool isDiscrete() const
+    {
+        return false;
+    }
 };
 
+/**
+ * @brief Index of first key frame with time >= time (count if there is none).
+ *
+ * Checks cursor (index found by previous lookup) and the one after it before falling back to binary
+ * search, during playback next lookup time is almost always in the same or next key frame interval.
+ * GetTime(index) returns time of key frame at index, cursor is set to found index.
+ */
+template <typename GetTime>
+size_t findKeyFrameIndex(size_t& cursor, size_t count, Milliseconds time, GetTime getTime)
+{
+    auto isBefore = [&getTime, time](size_t index) { return getTime(index) < time; };
+
+    // cached key frame, then the one after it
+    for (auto index = cursor; index <= count && index <= cursor + 1; ++index) {
+        if ((index == 0 || isBefore(index - 1)) && (index == count || !isBefore(index))) {
+            cursor = index;
+            return index;
+        }
+    }
+
+    size_t first = 0;
+    size_t length = count;
+    while (length > 0) {
+        auto half = length / 2;
+        if (isBefore(first + half)) {
+            first += half + 1;
+            length -= half + 1;
+        }
+        else {
+            length = half;
+        }
+    }
+    cursor = first;
+    return first;
+}
+
 /**
  * @brief Template implementation for key frame based animation channel.
  *
  * Type T is target property type and K is key frame type.
- * Update function is called to update target with value obtained from interpolating two key frames.
- * Channel has a propertyPath that is passed to update function and can be used by property
- * function to determine which property of target needs to be updated.
+ * Property P binds and updates target property, P::bind(propertyPath, target) resolves
+ * P::Binding when channel is bound and P::update(value, propertyPath, binding) is called to update
+ * target with value obtained from interpolating two key frames. Property path can be used by
+ * property functions to determine which property of target needs to be updated.
+ *
+ * Channel caches the key frame found by last update so lookup falls back to binary search only on
+ * seeks and backward time.
  */
-template <typename T,
-          typename K,
-          void (*Update)(T value, size_t propertyPath, Channel::Target target)>
+template <typename T, typename K, typename P>
 class KeyFrameChannel : public Channel {
 private:
     size_t _propertyPath;
     std::vector<K> _keyFrames;
+    size_t _cursor;
+    typename P::Binding _binding;
+
+    /**
+     * @brief Index of first key frame with time >= time (key frame count if there is none).
+     */
+    size_t findKeyFrame(Milliseconds time)
+    {
+        return findKeyFrameIndex(_cursor, _keyFrames.size(), time,
+                                 [this](size_t index) { return _keyFrames[index].getTime(); });
+    }
 
 public:
     KeyFrameChannel(size_t propertyPath, std::vector<K> keyFrames)
         : _propertyPath{propertyPath}
         , _keyFrames{std::move(keyFrames)}
+        , _cursor{0}
+        , _binding{}
     {
     }
 
     /**
-     * @brief Update channel to specified time.
+     * @brief Bind channel property to target.
      */
-    void updateTarget(Milliseconds time, Channel::Target target) override
+    void bind(Channel::Target target) override
     {
-        auto it = _keyFrames.begin();
-        auto itPrevious = it;
-        while (it != _keyFrames.end() && it->getTime() < time) {
-            itPrevious = it;
-            ++it;
-        }
+        _binding = P::bind(_propertyPath, target);
+    }
 
-        float t = 1;
+    /**
+     * @brief Update bound target to specified time.
+     */
+    void updateTarget(Milliseconds time) override
+    {
+        auto it = _keyFrames.begin() + findKeyFrame(time);
+        auto itPrevious = it == _keyFrames.begin() ? it : it - 1;
+
+        // before first and after last key frame evaluate key frame with itself
+        float t = 0;
         if (it == _keyFrames.end()) {
             it = itPrevious;
         }
-        else {
+        else if (it != itPrevious) {
             auto dt = time - itPrevious->getTime();
             auto duration = it->getTime() - itPrevious->getTime();
             t = static_cast<float>(dt.count()) / static_cast<float>(duration.count());
             t = std::max(0.0f, std::min(1.0f, t));
         }
-        Update(itPrevious->getValueAt(*it, t), _propertyPath, target);
+        P::update(itPrevious->getValueAt(*it, t), _propertyPath, _binding);
     }
 
     /**
@@ -133,6 +217,102 @@ public:
         return _keyFrames;
     }
 };
+
+/**
+ * @brief Key frame channel for ConstKeyFrameT<T> key frames that writes target only on key
+ *        transitions.
+ *
+ * Discrete properties (hidden flags, active camera) dispatch work when written, so channel
+ * remembers last applied key frame and skips updates that evaluate the same key frame. Seeking to
+ * a different key frame applies it, reset forces next update to apply current key frame.
+ * Property P has the same form as KeyFrameChannel property.
+ */
+template <typename T, typename P>
+class ConstKeyFrameChannel : public Channel {
+private:
+    /**
+     * @brief Applied key frame index value before first update.
+     */
+    static constexpr size_t NotApplied = std::numeric_limits<size_t>::max();
+
+    size_t _propertyPath;
+    std::vector<ConstKeyFrameT<T>> _keyFrames;
+    size_t _cursor;
+    size_t _appliedIndex;
+    typename P::Binding _binding;
+
+public:
+    ConstKeyFrameChannel(size_t propertyPath, std::vector<ConstKeyFrameT<T>> keyFrames)
+        : _propertyPath{propertyPath}
+        , _keyFrames{std::move(keyFrames)}
+        , _cursor{0}
+        , _appliedIndex{NotApplied}
+        , _binding{}
+    {
+    }
+
+    /**
+     * @brief Bind channel property to target, next update applies current key frame.
+     */
+    void bind(Channel::Target target) override
+    {
+        _binding = P::bind(_propertyPath, target);
+        _appliedIndex = NotApplied;
+    }
+
+    /**
+     * @brief Update bound target to specified time if key frame at time wasn't applied yet.
+     */
+    void updateTarget(Milliseconds time) override
+    {
+        if (_keyFrames.empty()) {
+            return;
+        }
+
+        // same key frame as KeyFrameChannel evaluates, previous one at exact key frame time
+        auto index = findKeyFrameIndex(_cursor, _keyFrames.size(), time,
+                                       [this](size_t i) { return _keyFrames[i].getTime(); });
+        index = index == 0 ? 0 : index - 1;
+        if (index == _appliedIndex) {
+            return;
+        }
+
+        P::update(_keyFrames[index].getValue(), _propertyPath, _binding);
+        _appliedIndex = index;
+    }
+
+    /**
+     * @brief Next update applies current key frame.
+     */
+    void reset() override
+    {
+        _appliedIndex = NotApplied;
+    }
+
+    /**
+     * @brief Const key frame channels write discrete state.
+     */
+    bool isDiscrete() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Channel target property path.
+     */
+    size_t getPropertyPath() const
+    {
+        return _propertyPath;
+    }
+
+    /**
+     * @brief Chronologically ordered keyframe vector.
+     */
+    const std::vector<ConstKeyFrameT<T>>& getKeyFrames() const
+    {
+        return _keyFrames;
+    }
+};
 }
 }
 }
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+
+namespace ipp {
+namespace scene {
+namespace animation {
+
+/**
+ * @brief Read-only array of channel values that either owns its elements or references elements
+ *        stored elsewhere.
+ *
+ * Referenced elements are evaluated in place (eg. flatbuffer vectors of Scene resource buffer
+ * retained by the Scene), referencing owner must outlive the array.
+ */
+template <typename T>
+class ChannelData final {
+private:
+    std::vector<T> _values;
+    const T* _data;
+    size_t _size;
+
+public:
+    ChannelData()
+        : _data{nullptr}
+        , _size{0}
+    {
+    }
+
+    ChannelData(std::vector<T> values)
+        : _values{std::move(values)}
+        , _data{_values.data()}
+        , _size{_values.size()}
+    {
+    }
+
+    ChannelData(const ChannelData& other)
+        : _values{other._values}
+        , _data{other.isReference() ? other._data : _values.data()}
+        , _size{other._size}
+    {
+    }
+
+    ChannelData(ChannelData&& other)
+        : _values{std::move(other._values)}
+        , _data{other._data}
+        , _size{other._size}
+    {
+    }
+
+    ChannelData& operator=(const ChannelData& other)
+    {
+        _values = other._values;
+        _data = other.isReference() ? other._data : _values.data();
+        _size = other._size;
+        return *this;
+    }
+
+    ChannelData& operator=(ChannelData&& other)
+    {
+        auto reference = other.isReference();
+        _values = std::move(other._values);
+        _data = reference ? other._data : _values.data();
+        _size = other._size;
+        return *this;
+    }
+
+    /**
+     * @brief Reference size elements at data, elements are copied if data isn't aligned for T.
+     */
+    static ChannelData Reference(const T* data, size_t size)
+    {
+        if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+            std::vector<T> values(size);
+            std::memcpy(values.data(), data, size * sizeof(T));
+            return ChannelData(std::move(values));
+        }
+
+        ChannelData reference;
+        reference._data = data;
+        reference._size = size;
+        return reference;
+    }
+
+    /**
+     * @brief True if elements are not owned by array.
+     */
+    bool isReference() const
+    {
+        return _data != _values.data();
+    }
+
+    const T& operator[](size_t index) const
+    {
+        return _data[index];
+    }
+
+    const T* data() const
+    {
+        return _data;
+    }
+
+    const T* begin() const
+    {
+        return _data;
+    }
+
+    const T* end() const
+    {
+        return _data + _size;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+};
+}
+}
+}
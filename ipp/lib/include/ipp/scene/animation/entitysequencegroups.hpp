@@ -0,0 +1,80 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/task/threadpool.hpp>
+#include "sequence.hpp"
+
+namespace ipp {
+namespace scene {
+namespace animation {
+
+/**
+ * @brief Entity sequences grouped by target entity.
+ *
+ * Entity sequences write only their target entity components so groups are updated in parallel
+ * on ThreadPool while sequences of the same group are updated in order on one thread, result does
+ * not depend on worker count.
+ */
+class EntitySequenceGroups final {
+private:
+    std::vector<EntitySequence> _sequences;
+    std::vector<std::vector<size_t>> _groups;
+    std::unordered_map<uint32_t, size_t> _groupIndices;
+    std::vector<uint8_t> _discrete;
+
+public:
+    explicit EntitySequenceGroups(std::vector<EntitySequence> sequences);
+
+    /**
+     * @brief Number of groups (target entities).
+     */
+    size_t size() const
+    {
+        return _groups.size();
+    }
+
+    /**
+     * @brief Group of sequences targeting entity, size() if entity isn't animated.
+     */
+    size_t find(const entity::Entity& entity) const
+    {
+        auto groupIt = _groupIndices.find(entity.getId());
+        return groupIt == _groupIndices.end() ? _groups.size() : groupIt->second;
+    }
+
+    /**
+     * @brief Does group have channels that write discrete state (see Channel::isDiscrete).
+     */
+    bool isDiscrete(size_t group) const
+    {
+        return _discrete[group] != 0;
+    }
+
+    /**
+     * @brief Number of sequences in group.
+     */
+    size_t getSequenceCount(size_t group) const
+    {
+        return _groups[group].size();
+    }
+
+    /**
+     * @brief Bind sequences of group to their target entity.
+     */
+    void bind(size_t group);
+
+    /**
+     * @brief Reset channel state cached by previous updates of all sequences.
+     */
+    void reset();
+
+    /**
+     * @brief Update sequences of groups (ordered group indices) at time on threadPool.
+     */
+    void update(task::ThreadPool& threadPool,
+                const std::vector<size_t>& groups,
+                Milliseconds time);
+};
+}
+}
+}
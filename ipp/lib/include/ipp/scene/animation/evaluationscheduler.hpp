@@ -0,0 +1,125 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+
+namespace ipp {
+namespace scene {
+namespace animation {
+
+/**
+ * @brief Decides which of a fixed set of animation items (entity sequence groups) are evaluated
+ *        in a frame.
+ *
+ * Items are evaluated every frame unless they are marked throttled for the frame. Throttled items
+ * with no screen size (off screen or hidden) are skipped unless they are marked as not culled
+ * (their evaluation can bring them in to view) in which case they are evaluated at maximum update
+ * interval, visible items smaller than LOD screen size are evaluated at power of two frame
+ * intervals and evaluation budget limits how many
+ * throttled items are evaluated per frame. Animation is evaluated at absolute time so skipped
+ * items catch up on their next evaluation, items that waited longest are evaluated first.
+ * Items evaluated since animation time last changed (see invalidate) are up to date and are not
+ * evaluated again.
+ */
+class EvaluationScheduler final {
+public:
+    /**
+     * @brief Throttling parameters.
+     */
+    struct Settings {
+        /**
+         * @brief Skip throttled culled items without screen size.
+         */
+        bool cullInvisible = true;
+
+        /**
+         * @brief Screen size below which update interval doubles every time screen size halves.
+         */
+        float lodScreenSize = 0.1f;
+
+        /**
+         * @brief Largest update interval in frames of visible and not culled items.
+         */
+        uint32_t maxUpdateInterval = 4;
+
+        /**
+         * @brief Maximum number of throttled items evaluated per frame, 0 for no limit.
+         */
+        size_t budget = 0;
+    };
+
+private:
+    Settings _settings;
+    std::vector<float> _screenSizes;
+    std::vector<uint32_t> _skippedFrames;
+    std::vector<uint8_t> _stale;
+    std::vector<uint8_t> _culled;
+    std::vector<size_t> _throttled;
+    std::vector<size_t> _scheduled;
+
+public:
+    explicit EvaluationScheduler(Settings settings, size_t itemCount = 0);
+
+    /**
+     * @brief Change item count, new items aren't up to date.
+     */
+    void resize(size_t itemCount);
+
+    /**
+     * @brief Animation time changed, no item is up to date.
+     */
+    void invalidate();
+
+    /**
+     * @brief Start scheduling a new frame, every item is evaluated unless marked throttled.
+     */
+    void begin();
+
+    /**
+     * @brief Mark item throttled in current frame (it has no screen size until raised).
+     *
+     * Item without screen size is skipped only if every throttle call in the frame culls it.
+     */
+    void throttle(size_t item, bool cull = true);
+
+    /**
+     * @brief Raise screen size of throttled item, has no effect on items that aren't throttled.
+     */
+    void raiseScreenSize(size_t item, float screenSize)
+    {
+        if (_screenSizes[item] >= 0) {
+            _screenSizes[item] = std::max(_screenSizes[item], screenSize);
+        }
+    }
+
+    /**
+     * @brief Update interval in frames of throttled item with screen size (0 if never updated).
+     */
+    uint32_t getUpdateInterval(float screenSize, bool culled = true) const;
+
+    /**
+     * @brief Items to evaluate in current frame, every item is evaluated if all is true.
+     *
+     * Returned items are ordered by index, are up to date after the call and remain valid until
+     * next schedule call.
+     */
+    const std::vector<size_t>& schedule(bool all);
+
+    /**
+     * @brief Number of frames item has been waiting to be evaluated for.
+     */
+    uint32_t getSkippedFrames(size_t item) const
+    {
+        return _skippedFrames[item];
+    }
+
+    /**
+     * @brief Throttling parameters.
+     */
+    const Settings& getSettings() const
+    {
+        return _settings;
+    }
+};
+}
+}
+}
@@ -52,17 +52,62 @@ public:
 
 /**
  * @brief Specialized key frame type that implements bezier float interpolation mode.
+ *
+ * Bezier segments are precomputed by PrepareSegments when channel is loaded, time and value
+ * curves are converted to polynomial coefficients and inverse time curve is sampled in to a small
+ * lookup table so evaluation is a table lookup followed by a couple of Newton steps.
  */
 class FloatKeyFrame final {
 public:
     enum class InterpolationMode { Constant = 0, Linear, Bezier };
 
+    /**
+     * @brief Number of inverse time curve lookup table intervals per Bezier segment.
+     */
+    static constexpr size_t BezierLookupSize = 8;
+
+    /**
+     * @brief Number of Newton steps refining curve parameter from lookup table.
+     */
+    static constexpr size_t BezierNewtonSteps = 2;
+
 private:
+    /**
+     * @brief Bezier segment from this to next key frame.
+     *
+     * Time (normalized to segment duration) and value (relative to key frame value) are cubic
+     * polynomials in curve parameter s without constant term, lookup table contains s at evenly
+     * spaced normalized times. Segments where lookup and Newton steps aren't accurate enough
+     * (handles that make time curve almost flat) are solved exactly.
+     */
+    struct BezierSegment {
+        float time[3];
+        float value[3];
+        float lookup[BezierLookupSize + 1];
+        bool exact;
+    };
+
     Milliseconds _time;
     float _value;
     InterpolationMode _interpolationMode;
     glm::vec2 _bezierLeft;
     glm::vec2 _bezierRight;
+    BezierSegment _bezierSegment;
+
+    /**
+     * @brief Precompute Bezier segment to next key frame.
+     */
+    void prepareSegment(const FloatKeyFrame& next);
+
+    /**
+     * @brief Bezier segment curve parameter at normalized segment time t.
+     */
+    float getBezierParameter(float t) const;
+
+    /**
+     * @brief Bezier segment value at normalized segment time t.
+     */
+    float getBezierValueAt(float t) const;
 
 public:
     FloatKeyFrame(Milliseconds time,
@@ -75,9 +120,17 @@ public:
         , _interpolationMode{interpolationMode}
         , _bezierLeft{bezierLeft}
         , _bezierRight{bezierRight}
+        , _bezierSegment{}
     {
     }
 
+    /**
+     * @brief Precompute Bezier segments of chronologically ordered key frames.
+     *
+     * Must be called before Bezier key frames are evaluated, last key frame has no segment.
+     */
+    static void PrepareSegments(std::vector<FloatKeyFrame>& keyFrames);
+
     /**
      * @brief Key frame time.
      */
@@ -111,16 +164,20 @@ public:
 
     /**
      * @brief Bezier interpolation left control (interpolation between previous point and this one).
+     *
+     * Control point x is time in milliseconds and y is value.
      */
-    glm::vec2 getBezierLeft()
+    glm::vec2 getBezierLeft() const
     {
         return _bezierLeft;
     }
 
     /**
      * @brief Bezier interpolation right control (interpolation between next point and this one).
+     *
+     * Control point x is time in milliseconds and y is value.
      */
-    glm::vec2 getBezierRight()
+    glm::vec2 getBezierRight() const
     {
         return _bezierRight;
     }
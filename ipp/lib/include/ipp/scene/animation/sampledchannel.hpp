@@ -0,0 +1,198 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/render/armature.hpp>
+#include "channel.hpp"
+#include "channeldata.hpp"
+
+namespace ipp {
+namespace scene {
+namespace animation {
+
+/**
+ * @brief Vector property samples recorded at a fixed rate, quantized to 16 bits per component.
+ *
+ * Only components in component mask are stored, every component is quantized over its own
+ * [min, min + extent] range. Sample lookup is index math on time and values between samples
+ * are linearly interpolated. Samples can reference resource data directly.
+ */
+class QuantizedVectorSamples final {
+public:
+    /**
+     * @brief Maximum number of vector components.
+     */
+    static constexpr size_t MaxComponentCount = 4;
+
+private:
+    Milliseconds _startTime;
+    float _sampleRate;
+    size_t _componentMask;
+    size_t _componentCount;
+    size_t _sampleCount;
+    glm::vec4 _rangeMin;
+    glm::vec4 _rangeExtent;
+    ChannelData<uint16_t> _samples;
+
+public:
+    /**
+     * @brief Create samples from quantized values.
+     *
+     * Sample rate is in samples per second, samples contain one value per component in component
+     * mask for every sample, range min and extent are indexed by component.
+     */
+    QuantizedVectorSamples(Milliseconds startTime,
+                           float sampleRate,
+                           size_t componentMask,
+                           glm::vec4 rangeMin,
+                           glm::vec4 rangeExtent,
+                           ChannelData<uint16_t> samples);
+
+    /**
+     * @brief Quantize values sampled at sample rate starting at start time.
+     */
+    static QuantizedVectorSamples Quantize(Milliseconds startTime,
+                                           float sampleRate,
+                                           size_t componentMask,
+                                           const std::vector<glm::vec4>& values);
+
+    /**
+     * @brief Interpolated value at time, components not in component mask are 0.
+     */
+    glm::vec4 getValueAt(Milliseconds time) const;
+
+    /**
+     * @brief Number of samples.
+     */
+    size_t size() const
+    {
+        return _sampleCount;
+    }
+
+    /**
+     * @brief Bit mask of stored components.
+     */
+    size_t getComponentMask() const
+    {
+        return _componentMask;
+    }
+};
+
+/**
+ * @brief Armature bone pose samples recorded at a fixed rate.
+ *
+ * Translation and scale are quantized to 16 bits per component over their ranges, rotation is
+ * stored with smallest three compression (three smallest quaternion components quantized to 15
+ * bits, index of omitted largest component in the two remaining bits). Samples can reference
+ * resource data directly.
+ */
+class QuantizedPoseSamples final {
+private:
+    Milliseconds _startTime;
+    float _sampleRate;
+    size_t _sampleCount;
+    glm::vec4 _rangeMin;
+    glm::vec4 _rangeExtent;
+    ChannelData<uint16_t> _translationScales;
+    ChannelData<uint16_t> _rotations;
+
+public:
+    /**
+     * @brief Create samples from quantized values.
+     *
+     * Translation and scale samples contain 4 values per sample (translation x, y, z and scale)
+     * quantized over range min and extent, rotation samples contain 3 values per sample.
+     */
+    QuantizedPoseSamples(Milliseconds startTime,
+                         float sampleRate,
+                         glm::vec4 rangeMin,
+                         glm::vec4 rangeExtent,
+                         ChannelData<uint16_t> translationScales,
+                         ChannelData<uint16_t> rotations);
+
+    /**
+     * @brief Quantize poses sampled at sample rate starting at start time.
+     */
+    static QuantizedPoseSamples Quantize(
+        Milliseconds startTime,
+        float sampleRate,
+        const std::vector<ipp::render::Armature::Bone::Pose>& poses);
+
+    /**
+     * @brief Compress normalized quaternion to 3 values with smallest three encoding.
+     */
+    static void QuantizeRotation(const glm::quat& rotation, uint16_t quantized[3]);
+
+    /**
+     * @brief Decompress smallest three encoded quaternion.
+     */
+    static glm::quat DequantizeRotation(const uint16_t quantized[3]);
+
+    /**
+     * @brief Interpolated pose at time.
+     */
+    ipp::render::Armature::Bone::Pose getValueAt(Milliseconds time) const;
+
+    /**
+     * @brief Number of samples.
+     */
+    size_t size() const
+    {
+        return _sampleCount;
+    }
+};
+
+/**
+ * @brief Animation channel that evaluates fixed rate samples S.
+ *
+ * Property P has the same form as KeyFrameChannel property with S::getValueAt value type.
+ */
+template <typename S, typename P>
+class SampledChannel : public Channel {
+private:
+    size_t _propertyPath;
+    S _samples;
+    typename P::Binding _binding;
+
+public:
+    SampledChannel(size_t propertyPath, S samples)
+        : _propertyPath{propertyPath}
+        , _samples{std::move(samples)}
+        , _binding{}
+    {
+    }
+
+    /**
+     * @brief Bind channel property to target.
+     */
+    void bind(Channel::Target target) override
+    {
+        _binding = P::bind(_propertyPath, target);
+    }
+
+    /**
+     * @brief Update bound target to specified time.
+     */
+    void updateTarget(Milliseconds time) override
+    {
+        P::update(_samples.getValueAt(time), _propertyPath, _binding);
+    }
+
+    /**
+     * @brief Channel target property path.
+     */
+    size_t getPropertyPath() const
+    {
+        return _propertyPath;
+    }
+
+    /**
+     * @brief Channel samples.
+     */
+    const S& getSamples() const
+    {
+        return _samples;
+    }
+};
+}
+}
+}
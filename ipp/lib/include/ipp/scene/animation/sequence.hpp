@@ -9,6 +9,9 @@ namespace animation {
 
 /**
  * @brief Collection of Actions nad Tracks that target properties of T.
+ *
+ * Static channels hold properties every Action animates with the same constant value (folded at
+ * load, see StaticChannelEliminator), they are applied to target whenever sequence is bound.
  */
 template <typename T>
 class Sequence {
@@ -16,12 +19,17 @@ private:
     T& _target;
     std::vector<Action> _actions;
     std::vector<Track> _tracks;
+    std::vector<std::unique_ptr<Channel>> _staticChannels;
 
 public:
-    Sequence(T& target, std::vector<Action> actions, std::vector<Track> tracks)
+    Sequence(T& target,
+             std::vector<Action> actions,
+             std::vector<Track> tracks,
+             std::vector<std::unique_ptr<Channel>> staticChannels = {})
         : _target{target}
         , _actions{std::move(actions)}
         , _tracks{std::move(tracks)}
+        , _staticChannels{std::move(staticChannels)}
     {
     }
 
@@ -29,9 +37,39 @@ public:
         : _target{other._target}
         , _actions{std::move(other._actions)}
         , _tracks{std::move(other._tracks)}
+        , _staticChannels{std::move(other._staticChannels)}
     {
     }
 
+    /**
+     * @brief Bind Action channels to sequence target and apply static channels to it.
+     *
+     * Must be called before update and whenever target components are replaced.
+     */
+    void bind()
+    {
+        for (auto& action : _actions) {
+            action.bind(Channel::Target(_target));
+        }
+        for (auto& channel : _staticChannels) {
+            channel->bind(Channel::Target(_target));
+            channel->reset();
+            channel->updateTarget(Milliseconds(0));
+        }
+    }
+
+    /**
+     * @brief Reset Action channels state cached by previous updates.
+     *
+     * Must be called when sequence target state is changed outside of sequence updates.
+     */
+    void reset()
+    {
+        for (auto& action : _actions) {
+            action.reset();
+        }
+    }
+
     /**
      * @brief Update sequence tracks.
      */
@@ -53,7 +91,7 @@ public:
     /**
      * @brief Sequence collection of Actions that animate sequence target.
      */
-    const std::vector<Action> getActions() const
+    const std::vector<Action>& getActions() const
     {
         return _actions;
     }
@@ -65,6 +103,14 @@ public:
     {
         return _tracks;
     }
+
+    /**
+     * @brief Channels of properties with the same constant value in every Action.
+     */
+    const std::vector<std::unique_ptr<Channel>>& getStaticChannels() const
+    {
+        return _staticChannels;
+    }
 };
 
 using EntitySequence = Sequence<entity::Entity>;
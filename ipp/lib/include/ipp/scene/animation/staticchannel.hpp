@@ -0,0 +1,139 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include "channel.hpp"
+#include "keyframe.hpp"
+
+namespace ipp {
+namespace scene {
+namespace animation {
+
+/**
+ * @brief True if key frames evaluate to the same value at any time.
+ */
+bool isConstant(const std::vector<FloatKeyFrame>& keyFrames);
+
+/**
+ * @brief True if key frames evaluate to the same value at any time.
+ */
+bool isConstant(const std::vector<BonePoseKeyFrame>& keyFrames);
+
+/**
+ * @brief True if key frames have the same value.
+ */
+bool isSameValue(const FloatKeyFrame& keyFrame, const FloatKeyFrame& other);
+
+/**
+ * @brief True if key frames have the same pose.
+ */
+bool isSameValue(const BonePoseKeyFrame& keyFrame, const BonePoseKeyFrame& other);
+
+/**
+ * @brief Eliminates empty channels and constant channels of entity sequence properties.
+ *
+ * Properties are identified by key, every channel of every Action must be added before channels
+ * are eliminated. Property animated with the same constant value by every Action of the sequence
+ * is folded in to a static channel (see Sequence) created from its first channel. Property that
+ * some Actions don't animate keeps its current value in them so its channels are only eliminated
+ * if their constant value is the current value of target.
+ * Key frames added must outlive the eliminator.
+ */
+template <typename K>
+class StaticChannelEliminator final {
+private:
+    /**
+     * @brief Property animated only by channels with the same constant value.
+     */
+    struct StaticProperty {
+        bool isStatic;
+        const K* keyFrame;
+        size_t actionCount;
+        size_t lastAction;
+        bool isFolded;
+    };
+
+    size_t _actionCount;
+    std::unordered_map<size_t, StaticProperty> _properties;
+    std::vector<std::unique_ptr<Channel>> _staticChannels;
+
+public:
+    /**
+     * @brief Eliminator of sequence with actionCount Actions.
+     */
+    explicit StaticChannelEliminator(size_t actionCount)
+        : _actionCount{actionCount}
+    {
+    }
+
+    /**
+     * @brief Track property animated by key frames of Action with index action, empty key frames
+     *        don't animate the property.
+     */
+    void add(size_t action, size_t key, const std::vector<K>& keyFrames)
+    {
+        if (keyFrames.empty()) {
+            return;
+        }
+
+        auto constant = isConstant(keyFrames);
+        auto it = _properties.find(key);
+        if (it == _properties.end()) {
+            _properties.emplace(key,
+                                StaticProperty{constant, &keyFrames.front(), 1, action, false});
+            return;
+        }
+        auto& property = it->second;
+        property.isStatic =
+            property.isStatic && constant && isSameValue(*property.keyFrame, keyFrames.front());
+        if (property.lastAction != action) {
+            property.actionCount++;
+            property.lastAction = action;
+        }
+    }
+
+    /**
+     * @brief Track property animated by channel with changing values.
+     */
+    void addAnimated(size_t key)
+    {
+        _properties[key] = StaticProperty{false, nullptr, 0, 0, false};
+    }
+
+    /**
+     * @brief True if channel with key frames is empty or static and can be eliminated.
+     *
+     * Static channel of property animated by every Action is created with createChannel once,
+     * isCurrentValue(keyFrame) tells if constant key frame value is current target value.
+     */
+    template <typename F, typename C>
+    bool eliminate(size_t key, const std::vector<K>& keyFrames, F createChannel, C isCurrentValue)
+    {
+        if (keyFrames.empty()) {
+            return true;
+        }
+
+        auto& property = _properties.at(key);
+        if (!property.isStatic) {
+            return false;
+        }
+        if (property.actionCount != _actionCount) {
+            return isCurrentValue(keyFrames.front());
+        }
+        if (!property.isFolded) {
+            _staticChannels.push_back(createChannel());
+            property.isFolded = true;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Move static channels of folded properties out of eliminator.
+     */
+    std::vector<std::unique_ptr<Channel>> takeStaticChannels()
+    {
+        return std::move(_staticChannels);
+    }
+};
+}
+}
+}
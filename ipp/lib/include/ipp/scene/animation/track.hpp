@@ -11,7 +11,9 @@ namespace animation {
  * @brief Track is a collection of animation Strips that bind animation Actions to targets.
  *
  * Strips cannot overlap in the track timeline, only one Action will be applied to Target
- * from Track at any time.
+ * from Track at any time. Strip start times are kept in a separate sorted array, strip used by
+ * previous update and the one after it are checked first and other strips are found with binary
+ * search.
  */
 class Track final : public NonCopyable {
 public:
@@ -89,10 +91,16 @@ public:
 private:
     std::string _name;
     std::vector<Strip> _strips;
+    std::vector<Milliseconds> _stripOffsets;
     Channel::Target _target;
-    std::vector<Strip>::iterator _stripLastUsed;
+    size_t _stripLastUsed;
     bool _muted;
 
+    /**
+     * @brief Index of strip applied at time, last strip starting before time or first strip.
+     */
+    size_t findStrip(Milliseconds time) const;
+
 public:
     Track(std::string name, std::vector<Strip> strips, Channel::Target target);
 
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include "channel.hpp"
+#include "channeldata.hpp"
+#include "keyframe.hpp"
+
+namespace ipp {
+namespace scene {
+namespace animation {
+
+/**
+ * @brief Key frames of up to 4 float components sharing key frame times.
+ *
+ * Key frames are stored as structure of arrays, times and interpolation modes in separate arrays
+ * and values packed as 4 floats per key frame so all components are interpolated at once (SSE
+ * when available). Only Constant and Linear interpolation modes are supported. Times and values
+ * can reference resource data directly.
+ */
+class VectorKeyFrames final {
+public:
+    /**
+     * @brief Number of packed components per key frame.
+     */
+    static constexpr size_t ComponentCount = 4;
+
+private:
+    ChannelData<int32_t> _times;
+    ChannelData<float> _values;
+    std::vector<uint8_t> _linear;
+    size_t _cursor;
+
+public:
+    /**
+     * @brief Create key frames from times in milliseconds, packed values (ComponentCount per key
+     *        frame) and interpolation mode of each key frame.
+     */
+    VectorKeyFrames(ChannelData<int32_t> times,
+                    ChannelData<float> values,
+                    const std::vector<FloatKeyFrame::InterpolationMode>& interpolationModes);
+
+    /**
+     * @brief Pack scalar component key frames, nullptr components are left 0.
+     *
+     * Components must be packable (see canPack).
+     */
+    explicit VectorKeyFrames(const std::vector<FloatKeyFrame>* components[ComponentCount]);
+
+    /**
+     * @brief True if non null components have same key frame times and interpolation modes and
+     *        use no Bezier interpolation.
+     */
+    static bool canPack(const std::vector<FloatKeyFrame>* components[ComponentCount]);
+
+    /**
+     * @brief Interpolated value at time, uses same key frame semantics as KeyFrameChannel.
+     */
+    glm::vec4 getValueAt(Milliseconds time);
+
+    /**
+     * @brief Key frame count.
+     */
+    size_t size() const
+    {
+        return _times.size();
+    }
+
+    /**
+     * @brief Chronologically ordered key frame times in milliseconds.
+     */
+    const ChannelData<int32_t>& getTimes() const
+    {
+        return _times;
+    }
+
+    /**
+     * @brief Key frame values, ComponentCount floats per key frame.
+     */
+    const ChannelData<float>& getValues() const
+    {
+        return _values;
+    }
+};
+
+/**
+ * @brief Animation channel that updates up to 4 components of a vector property at once.
+ *
+ * Property P has the same form as KeyFrameChannel property with glm::vec4 value type, property
+ * path is a bit mask of animated components.
+ */
+template <typename P>
+class VectorKeyFrameChannel : public Channel {
+private:
+    size_t _componentMask;
+    VectorKeyFrames _keyFrames;
+    typename P::Binding _binding;
+
+public:
+    VectorKeyFrameChannel(size_t componentMask, VectorKeyFrames keyFrames)
+        : _componentMask{componentMask}
+        , _keyFrames{std::move(keyFrames)}
+        , _binding{}
+    {
+    }
+
+    /**
+     * @brief Bind channel property to target.
+     */
+    void bind(Channel::Target target) override
+    {
+        _binding = P::bind(_componentMask, target);
+    }
+
+    /**
+     * @brief Update bound target to specified time.
+     */
+    void updateTarget(Milliseconds time) override
+    {
+        P::update(_keyFrames.getValueAt(time), _componentMask, _binding);
+    }
+
+    /**
+     * @brief Bit mask of animated components.
+     */
+    size_t getComponentMask() const
+    {
+        return _componentMask;
+    }
+
+    /**
+     * @brief Channel key frames.
+     */
+    const VectorKeyFrames& getKeyFrames() const
+    {
+        return _keyFrames;
+    }
+};
+}
+}
+}
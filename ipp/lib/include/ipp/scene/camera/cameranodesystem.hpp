@@ -52,6 +52,17 @@ public:
                      entity::World& world,
                      uint32_t defaultActiveEntityId);
 
+    /**
+     * @brief Active camera Entity id or 0 if no camera Entity is active.
+     */
+    uint32_t getActiveEntityId() const
+    {
+        if (_active == nullptr) {
+            return 0;
+        }
+        return _active->getEntity().getId();
+    }
+
     /**
      * @brief Camera eye position.
      */
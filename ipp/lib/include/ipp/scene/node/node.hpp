@@ -3,6 +3,7 @@
 #include <ipp/shared.hpp>
 #include <ipp/log.hpp>
 #include "nodetransform.hpp"
+#include "nodehierarchy.hpp"
 
 namespace ipp {
 namespace scene {
@@ -10,23 +11,36 @@ namespace node {
 
 /**
  * @brief Generic tree Node with hierarchical 3D transformation.
+ *
+ * Node is a view into a NodeHierarchy slot, detached nodes own a single node hierarchy and
+ * adding a child moves child subtree into parent hierarchy.
  */
 class Node {
 private:
-    Node* _parent;
-    std::vector<Node*> _children;
-    bool _hidden;
-    NodeTransform _transform;
-    glm::mat4 _transformLocalMatrix;
-    glm::mat4 _transformMatrix;
-    glm::mat4 _transformParentingInverseMatrix;
+    std::shared_ptr<NodeHierarchy> _hierarchy;
+    uint32_t _index;
+
+    friend class NodeHierarchy;
+
+protected:
+    /**
+     * @brief Called after transform properties or hidden flag get modified through node accessors.
+     */
+    virtual void onModified()
+    {
+    }
 
 public:
     Node();
+    Node(const Node&) = delete;
     virtual ~Node();
 
+    Node& operator=(const Node&) = delete;
+
     /**
      * @brief Add a node as a child to this node.
+     *
+     * Child is detached from its current parent before being attached to this node.
      */
     void addChild(Node* child, const glm::mat4& transformParentingInverseMatrix);
 
@@ -38,31 +52,58 @@ public:
     /**
      * @brief Update node transform matrices before drawing.
      *
-     * Calls updateTransform() on children recursively.
+     * Updates dirty subtrees of hierarchy this node belongs to in one linear pass.
      */
     void updateTransform();
 
+    /**
+     * @brief Update node transform matrices before drawing, independent subtrees are updated in
+     *        parallel on threadPool.
+     */
+    void updateTransform(task::ThreadPool& threadPool);
+
     /**
      * @brief Is node hidden, true if node set to hidden or any parent is hidden.
+     * @note Effective hidden state is cached by hierarchy update, only valid once update finishes
+     *       after every hidden flag change.
      */
-    bool isHidden() const;
+    bool isHidden() const
+    {
+        return _hierarchy->_effectiveHidden[_index] != 0;
+    }
+
+    /**
+     * @brief Node hidden flag, unlike isHidden ignores parent hidden state.
+     */
+    bool getHidden() const
+    {
+        return _hierarchy->_hidden[_index] != 0;
+    }
 
     /**
      * @brief Set node hidden/visible (also makes all child nodes hidden if true).
      */
     void setHidden(bool hidden)
     {
-        _hidden = hidden;
+        if (getHidden() != hidden) {
+            _hierarchy->_hidden[_index] = hidden;
+            _hierarchy->markDirty(_index, NodeHierarchy::VisibilityDirty);
+            onModified();
+        }
     }
 
     /**
-     * @brief Parent relative transform properties.
+     * @brief Parent relative transform properties, marks node dirty.
      *
-     * Changes to returned reference will be reflected in transform matrix after updateTransform
+     * Changes to returned reference will be reflected in transform matrix after updateTransform.
+     * Reference is invalidated by hierarchy structure changes (adding/removing nodes) and must
+     * not be kept across updates because node is only marked dirty when accessor gets called.
      */
     NodeTransform& getTransform()
     {
-        return _transform;
+        _hierarchy->markDirty(_index);
+        onModified();
+        return _hierarchy->_transforms[_index];
     }
 
     /**
@@ -70,25 +111,54 @@ public:
      */
     const NodeTransform& getTransform() const
     {
-        return _transform;
+        return _hierarchy->_transforms[_index];
     }
 
     /**
-     * @brief Parent relative transform matrix.
+     * @brief Absolute transform matrix (includes parent transform).
      * @note Only valid once update finishes after every transform property change.
      */
     const glm::mat4& getTransformMatrix() const
     {
-        return _transformMatrix;
+        return _hierarchy->_worldMatrices[_index];
     }
 
     /**
-     * @brief Absolute transform matrix (includes parent transform).
+     * @brief Parent relative transform matrix.
      * @note Only valid once update finishes after every transform property change.
      */
     const glm::mat4& getTransformLocalMatrix() const
     {
-        return _transformLocalMatrix;
+        return _hierarchy->_localMatrices[_index];
+    }
+
+    /**
+     * @brief Normal matrix (inverse transpose of world rotation/scale).
+     * @note Only valid if hierarchy computes NormalMatrixCache.
+     */
+    const glm::mat3& getNormalMatrix() const
+    {
+        return _hierarchy->_normalMatrices[_index];
+    }
+
+    /**
+     * @brief Inverse of absolute transform matrix.
+     * @note Only valid if hierarchy computes InverseWorldMatrixCache.
+     */
+    const glm::mat4& getTransformInverseMatrix() const
+    {
+        return _hierarchy->_inverseWorldMatrices[_index];
+    }
+
+    /**
+     * @brief Version of hierarchy update that last changed absolute transform matrix.
+     *
+     * Versions are unique across hierarchies, consumers can compare them to skip work derived
+     * from unchanged transform matrices.
+     */
+    uint32_t getTransformVersion() const
+    {
+        return _hierarchy->_worldVersions[_index];
     }
 
     /**
@@ -96,9 +166,37 @@ public:
      * Reference is valid as long as this node is valid and parent doesn't change.
      * Returned value is nullptr if node is not attached to a parent (eg. root node)
      */
-    Node* getParent()
+    Node* getParent();
+
+    /**
+     * @brief Parent node reference.
+     * Returned value is nullptr if node is not attached to a parent (eg. root node)
+     */
+    const Node* getParent() const;
+
+    /**
+     * @brief Hierarchy this node is stored in.
+     */
+    const NodeHierarchy& getHierarchy() const
+    {
+        return *_hierarchy;
+    }
+
+    /**
+     * @brief Hierarchy this node is stored in.
+     */
+    NodeHierarchy& getHierarchy()
+    {
+        return *_hierarchy;
+    }
+
+    /**
+     * @brief Node slot index in hierarchy.
+     * @note Slot index changes when hierarchy structure changes.
+     */
+    uint32_t getHierarchyIndex() const
     {
-        return _parent;
+        return _index;
     }
 };
 }
@@ -10,13 +10,54 @@ namespace node {
 
 /**
  * @brief Implements ComponentT and Node class to create a NodeComponent type.
+ *
+ * Transform and hidden flag modifications mark component dirty, including modifications made
+ * through a Node reference.
  */
 class NodeComponent : public Node, public entity::ComponentT<NodeComponent> {
+protected:
+    /**
+     * @brief Mark component dirty when Node accessors modify node.
+     */
+    void onModified() override
+    {
+        markDirty();
+    }
+
 public:
     NodeComponent(entity::Entity& entity)
         : entity::ComponentT<NodeComponent>(entity)
     {
     }
+
+    /**
+     * @brief Snapshot contains transform properties and hidden flag.
+     */
+    size_t getSnapshotSize() const override
+    {
+        return sizeof(NodeTransform) + sizeof(bool);
+    }
+
+    /**
+     * @brief Copy transform properties and hidden flag to snapshot buffer.
+     */
+    void writeSnapshot(uint8_t* buffer) const override
+    {
+        auto hidden = getHidden();
+        std::memcpy(buffer, &getTransform(), sizeof(NodeTransform));
+        std::memcpy(buffer + sizeof(NodeTransform), &hidden, sizeof(bool));
+    }
+
+    /**
+     * @brief Restore transform properties and hidden flag from snapshot buffer.
+     */
+    void readSnapshot(const uint8_t* buffer) override
+    {
+        bool hidden;
+        std::memcpy(&getTransform(), buffer, sizeof(NodeTransform));
+        std::memcpy(&hidden, buffer + sizeof(NodeTransform), sizeof(bool));
+        setHidden(hidden);
+    }
 };
 }
 }
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/noncopyable.hpp>
+#include "nodetransform.hpp"
+
+namespace ipp {
+namespace scene {
+namespace node {
+
+/**
+ * @brief Flat Node transform hierarchy stored as contiguous per-node arrays.
+ *
+ * Nodes are referenced by slot index, every array is indexed by the same slot.
+ * Parent slot index is always lower than child slot index so world matrices can be computed
+ * in a single linear pass over the arrays.
+ *
+ * Structural changes (attaching subtrees, detaching and releasing nodes) are cheap and only
+ * invalidate slot order, hierarchy is compacted and sorted to depth first order (each subtree
+ * occupies a contiguous slot range) on next update or when a subtree has to be moved.
+ *
+ * Node instances are views into a hierarchy and are kept in sync when slots move.
+ *
+ * Transform and hidden flag mutations mark slots dirty, update only recomputes subtrees with a
+ * dirty root. Effective hidden state (node or any ancestor hidden) is cached per slot.
+ *
+ * Parallel update partitions sorted hierarchy in to head slots (ancestors of large subtrees)
+ * that are updated sequentially and independent subtree work units updated on ThreadPool.
+ */
+class NodeHierarchy final : public NonCopyable {
+public:
+    /**
+     * @brief Parent slot index value for nodes without a parent.
+     */
+    static constexpr int32_t NoParent = -1;
+
+    /**
+     * @brief Slot dirty flags, World and Visibility flags propagate to descendants.
+     */
+    enum DirtyFlag : uint8_t {
+        LocalDirty = 1,
+        WorldDirty = 2,
+        VisibilityDirty = 4,
+        AllDirty = LocalDirty | WorldDirty | VisibilityDirty
+    };
+
+    /**
+     * @brief Optional per slot matrices derived from world matrix, computed only when requested.
+     */
+    enum CachedMatrix : uint8_t { NormalMatrixCache = 1, InverseWorldMatrixCache = 2 };
+
+    /**
+     * @brief Minimum number of nodes in a parallel work unit batch.
+     */
+    static constexpr size_t MinWorkUnitSize = 256;
+
+private:
+    std::vector<Node*> _nodes;
+    std::vector<int32_t> _parents;
+    std::vector<uint32_t> _subtreeSizes;
+    std::vector<NodeTransform> _transforms;
+    std::vector<glm::mat4> _parentingInverseMatrices;
+    std::vector<glm::mat4> _localMatrices;
+    std::vector<glm::mat4> _worldMatrices;
+    std::vector<glm::mat3> _normalMatrices;
+    std::vector<glm::mat4> _inverseWorldMatrices;
+    std::vector<uint32_t> _worldVersions;
+    std::vector<uint8_t> _hidden;
+    std::vector<uint8_t> _effectiveHidden;
+    std::vector<uint8_t> _dirty;
+    std::vector<Node*> _visibilityChangedNodes;
+    size_t _liveCount;
+    size_t _updatedCount;
+    bool _sorted;
+
+    std::vector<uint32_t> _headSlots;
+    std::vector<uint32_t> _workUnits;
+    std::vector<size_t> _workUnitBatches;
+    size_t _workUnitSize;
+
+    uint32_t _updateVersion;
+    uint8_t _cachedMatrices;
+
+    /**
+     * @brief Append a slot for node without parent and return slot index.
+     */
+    uint32_t add(Node* node);
+
+    /**
+     * @brief Release slot, children of released slot are detached on next sort.
+     */
+    void release(uint32_t index);
+
+    /**
+     * @brief Attach slot as a child of parent slot.
+     */
+    void attach(uint32_t index, uint32_t parent, const glm::mat4& parentingInverseMatrix);
+
+    /**
+     * @brief Detach slot from parent slot, detached slot keeps its subtree.
+     */
+    void detach(uint32_t index);
+
+    /**
+     * @brief Move subtree rooted at index in source hierarchy to this hierarchy under parent.
+     */
+    void attachSubtree(NodeHierarchy& source,
+                       uint32_t index,
+                       uint32_t parent,
+                       const glm::mat4& parentingInverseMatrix);
+
+    /**
+     * @brief Split sorted hierarchy in to head slots and work units no larger than unitSize.
+     */
+    void partition(size_t unitSize);
+
+    /**
+     * @brief Dirty flags slot inherits from parent slot.
+     */
+    uint8_t getInheritedDirtyFlags(int32_t parent) const;
+
+    /**
+     * @brief Compose local matrices of slots in [begin, end) range marked LocalDirty.
+     */
+    void updateLocalMatrices(size_t begin, size_t end);
+
+    /**
+     * @brief Update slot according to its dirty flags, returns true if world matrix changed.
+     */
+    bool updateSlot(size_t index, std::vector<Node*>& visibilityChangedNodes);
+
+    /**
+     * @brief Update dirty subtrees within [begin, end) slot range, returns updated node count.
+     *
+     * Range must contain complete subtrees.
+     */
+    size_t updateRange(size_t begin, size_t end, std::vector<Node*>& visibilityChangedNodes);
+
+    friend class Node;
+
+public:
+    NodeHierarchy();
+
+    /**
+     * @brief Remove released slots and reorder nodes to depth first order.
+     *
+     * After sort every subtree occupies range [index, index + getSubtreeSize(index)).
+     */
+    void sort();
+
+    /**
+     * @brief Sort hierarchy if structure changed and update matrices of dirty subtrees.
+     */
+    void update();
+
+    /**
+     * @brief Update dirty subtrees of hierarchy in parallel on threadPool.
+     *
+     * Falls back to sequential update for serial pools and small hierarchies.
+     */
+    void update(task::ThreadPool& threadPool);
+
+    /**
+     * @brief Mark slot dirty, slot and its descendants get updated on next update.
+     */
+    void markDirty(uint32_t index, DirtyFlag flag = LocalDirty)
+    {
+        _dirty[index] |= flag;
+    }
+
+    /**
+     * @brief Request CachedMatrix flags to be computed with world matrices from next update on.
+     */
+    void requestCachedMatrices(uint8_t cachedMatrices);
+
+    /**
+     * @brief CachedMatrix flags computed by update.
+     */
+    uint8_t getCachedMatrices() const
+    {
+        return _cachedMatrices;
+    }
+
+    /**
+     * @brief Nodes with effective hidden state changed by last update.
+     *
+     * Released nodes are removed from the list.
+     */
+    const std::vector<Node*>& getVisibilityChangedNodes() const
+    {
+        return _visibilityChangedNodes;
+    }
+
+    /**
+     * @brief Number of nodes with world matrix recomputed by last update.
+     */
+    size_t getUpdatedCount() const
+    {
+        return _updatedCount;
+    }
+
+    /**
+     * @brief Number of slots (including released slots if hierarchy isn't sorted).
+     */
+    size_t size() const
+    {
+        return _nodes.size();
+    }
+
+    /**
+     * @brief True if hierarchy is compact and in depth first order.
+     */
+    bool isSorted() const
+    {
+        return _sorted;
+    }
+
+    /**
+     * @brief Node viewing slot, nullptr for released slots.
+     */
+    Node* getNode(uint32_t index) const
+    {
+        return _nodes[index];
+    }
+
+    /**
+     * @brief Parent slot index or NoParent.
+     */
+    int32_t getParentIndex(uint32_t index) const
+    {
+        return _parents[index];
+    }
+
+    /**
+     * @brief Number of slots in subtree rooted at index (including index).
+     * @note Only valid if hierarchy is sorted.
+     */
+    uint32_t getSubtreeSize(uint32_t index) const
+    {
+        return _subtreeSizes[index];
+    }
+
+    /**
+     * @brief World transform matrices indexed by slot.
+     */
+    const std::vector<glm::mat4>& getWorldMatrices() const
+    {
+        return _worldMatrices;
+    }
+};
+}
+}
+}
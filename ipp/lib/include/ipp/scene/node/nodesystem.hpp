@@ -14,6 +14,7 @@ namespace node {
  */
 class NodeSystem final : public loop::SystemT<NodeSystem> {
 private:
+    task::ThreadPool& _threadPool;
     Node _rootNode;
 
     /**
@@ -22,7 +23,7 @@ private:
     void onUpdate() override;
 
 public:
-    NodeSystem(loop::MessageLoop& messageLoop);
+    NodeSystem(loop::MessageLoop& messageLoop, task::ThreadPool& threadPool);
 
     /**
      * @brief Root scene node.
@@ -41,6 +42,22 @@ public:
     {
         return _rootNode;
     }
+
+    /**
+     * @brief Number of nodes with transform matrices recomputed by last update.
+     */
+    size_t getUpdatedNodeCount() const
+    {
+        return _rootNode.getHierarchy().getUpdatedCount();
+    }
+
+    /**
+     * @brief Nodes with effective hidden state changed by last update.
+     */
+    const std::vector<Node*>& getVisibilityChangedNodes() const
+    {
+        return _rootNode.getHierarchy().getVisibilityChangedNodes();
+    }
 };
 }
 }
@@ -37,6 +37,14 @@ struct NodeTransform {
      */
     operator glm::mat4() const;
 };
+
+/**
+ * @brief Compose count transforms in to column major matrices (same result as operator mat4).
+ *
+ * Rotation matrices are built in closed form, runs of quaternion transforms are composed four
+ * at a time with SIMD kernel.
+ */
+void composeTransformMatrices(const NodeTransform* transforms, size_t count, glm::mat4* matrices);
 }
 }
 }
@@ -28,10 +28,11 @@ public:
     }
 
     /**
-     * @brief Armature current skinning bone poses.
+     * @brief Armature current skinning bone poses, marks component dirty.
      */
     std::vector<::ipp::render::Armature::Bone::Pose>& getBonePoses()
     {
+        markDirty();
         return _bonePoses;
     }
 
@@ -42,6 +43,30 @@ public:
     {
         return _bonePoses;
     }
+
+    /**
+     * @brief Snapshot contains current bone poses.
+     */
+    size_t getSnapshotSize() const override
+    {
+        return _bonePoses.size() * sizeof(::ipp::render::Armature::Bone::Pose);
+    }
+
+    /**
+     * @brief Copy bone poses to snapshot buffer.
+     */
+    void writeSnapshot(uint8_t* buffer) const override
+    {
+        std::memcpy(buffer, _bonePoses.data(), getSnapshotSize());
+    }
+
+    /**
+     * @brief Restore bone poses from snapshot buffer.
+     */
+    void readSnapshot(const uint8_t* buffer) override
+    {
+        std::memcpy(_bonePoses.data(), buffer, getSnapshotSize());
+    }
 };
 }
 }
@@ -19,6 +19,8 @@ private:
     ipp::render::MaterialBuffer _materialBuffer;
     ArmatureComponent* _skinningArmature;
     std::vector<ipp::render::gl::VertexDefinition> _passVertexDefinitions;
+    uint32_t _writtenTransformVersion;
+    uint32_t _writtenCameraVersion;
 
 public:
     RenderableComponent(entity::Entity& entity,
@@ -63,6 +65,22 @@ public:
     {
         return _skinningArmature;
     }
+
+    /**
+     * @brief Store node transform/camera versions material buffer matrices get written for.
+     *
+     * Returns false if matrices for the same versions have already been written.
+     */
+    bool updateWrittenMatrixVersions(uint32_t transformVersion, uint32_t cameraVersion)
+    {
+        if (_writtenTransformVersion == transformVersion &&
+            _writtenCameraVersion == cameraVersion) {
+            return false;
+        }
+        _writtenTransformVersion = transformVersion;
+        _writtenCameraVersion = cameraVersion;
+        return true;
+    }
 };
 }
 }
@@ -50,11 +50,38 @@ public:
      */
     using LightGroup = entity::EntityGroupWithComponents<LightComponent, node::NodeComponent>;
 
+    /**
+     * @brief Renderable inside camera frustum in last rendered frame.
+     *
+     * Screen size is projected bounding sphere radius relative to viewport half height,
+     * renderables without mesh bounds have maximum float screen size. Renderable entity is
+     * referenced by id as it can be removed after visibility is recorded.
+     */
+    struct RenderableVisibility {
+        uint32_t entityId;
+        float screenSize;
+    };
+
+    /**
+     * @brief Visible renderables frame value before visibility is first recorded.
+     */
+    static constexpr uint64_t NoVisibilityFrame = std::numeric_limits<uint64_t>::max();
+
 private:
+    entity::World& _world;
+    task::ThreadPool& _threadPool;
     camera::CameraSystem* _cameraSystem;
+    node::NodeSystem* _nodeSystem;
     glm::ivec2 _viewportDimensions;
     RenderableGroup* _renderableEntities;
     LightGroup* _lightEntities;
+    std::vector<RenderableComponent*> _visibilityChangedRenderables;
+    std::vector<std::tuple<float, RenderableComponent*>> _renderQueue;
+    std::vector<RenderableVisibility> _visibleRenderables;
+    uint64_t _visibleRenderablesFrame;
+    uint32_t _cameraVersion;
+    glm::mat4 _cameraViewMatrix;
+    glm::mat4 _cameraProjectionMatrix;
 
     /**
      * @brief Initialize render system
@@ -87,7 +114,9 @@ private:
     void renderParticles(const std::vector<std::tuple<float, RenderableComponent*>>& renderables);
 
 public:
-    RenderSystem(loop::MessageLoop& messageLoop, entity::World& scene);
+    RenderSystem(loop::MessageLoop& messageLoop,
+                 entity::World& scene,
+                 task::ThreadPool& threadPool);
 
     /**
      * @brief EntityGroup containing all Entities with Renderable/Node components.
@@ -97,6 +126,30 @@ public:
         return *_renderableEntities;
     }
 
+    /**
+     * @brief Renderables with effective visibility changed in current frame.
+     */
+    const std::vector<RenderableComponent*>& getVisibilityChangedRenderables() const
+    {
+        return _visibilityChangedRenderables;
+    }
+
+    /**
+     * @brief Renderables that are not hidden and intersect camera frustum in last rendered frame.
+     */
+    const std::vector<RenderableVisibility>& getVisibleRenderables() const
+    {
+        return _visibleRenderables;
+    }
+
+    /**
+     * @brief World frame visible renderables were recorded in (NoVisibilityFrame if never).
+     */
+    uint64_t getVisibleRenderablesFrame() const
+    {
+        return _visibleRenderablesFrame;
+    }
+
     /**
      * @brief Return scene viewport dimensions.
      */
@@ -2,6 +2,8 @@
 
 #include <ipp/shared.hpp>
 #include <ipp/entity/world.hpp>
+#include <ipp/resource/resourcebuffer.hpp>
+#include "scenecheckpoint.hpp"
 
 namespace ipp {
 namespace scene {
@@ -12,11 +14,17 @@ namespace scene {
 class Scene final {
 private:
     Context& _context;
+    std::unique_ptr<resource::ResourceBuffer> _data;
     loop::MessageLoop _messageLoop;
     entity::World _world;
     std::string _resourcePath;
 
 public:
+    /**
+     * @brief Deserialize Scene from resource data.
+     *
+     * Data is retained for Scene lifetime because animation channels evaluate it in place.
+     */
     Scene(Context& context, std::unique_ptr<resource::ResourceBuffer> data);
 
     /**
@@ -24,6 +32,19 @@ public:
      */
     void update();
 
+    /**
+     * @brief Capture Scene component state and active camera in to checkpoint.
+     */
+    void captureCheckpoint(SceneCheckpoint& checkpoint) const;
+
+    /**
+     * @brief Restore Scene state from checkpoint captured on this Scene.
+     *
+     * Component state is restored in place, active camera change is enqueued as a command and
+     * applied on next update.
+     */
+    void restoreCheckpoint(const SceneCheckpoint& checkpoint);
+
     /**
      * @brief Scene MessageLoop
      */
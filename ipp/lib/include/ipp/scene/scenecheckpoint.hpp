@@ -0,0 +1,24 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/entity/worldsnapshot.hpp>
+
+namespace ipp {
+namespace scene {
+
+/**
+ * @brief Scene state captured by Scene::captureCheckpoint used to seek without replaying updates.
+ */
+struct SceneCheckpoint {
+    /**
+     * @brief Scene World component state (node transforms, hidden flags, bone poses).
+     */
+    entity::WorldSnapshot worldSnapshot;
+
+    /**
+     * @brief Active camera Entity id, 0 if no camera Entity was active.
+     */
+    uint32_t activeCameraEntityId = 0;
+};
+}
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/noncopyable.hpp>
+#include "bounds.hpp"
+
+namespace ipp {
+namespace scene {
+namespace spatial {
+
+/**
+ * @brief Dynamic bounding volume hierarchy of enlarged ("fat") proxy boxes.
+ *
+ * Proxies store a box grown by margin so small movements do not change the tree, moving a proxy
+ * outside of it's fat box reinserts it using surface area heuristic. Tree is kept balanced with
+ * AVL style rotations so queries stay logarithmic under incremental updates.
+ *
+ * Nodes are stored in a single vector (indices instead of pointers) with a free list.
+ */
+class BoundingVolumeHierarchy final : public NonCopyable {
+public:
+    /**
+     * @brief Invalid node/proxy index.
+     */
+    static constexpr int32_t NullNode = -1;
+
+private:
+    struct TreeNode {
+        BoundingBox bounds;
+        uint32_t userId;
+        // parent index or next free node index when node is in free list
+        int32_t parent;
+        int32_t child1;
+        int32_t child2;
+        // leaf height is 0, free node height is -1
+        int32_t height;
+
+        bool isLeaf() const
+        {
+            return child1 == NullNode;
+        }
+    };
+
+    std::vector<TreeNode> _nodes;
+    int32_t _root;
+    int32_t _freeList;
+    size_t _proxyCount;
+    float _margin;
+
+    int32_t allocateNode();
+    void freeNode(int32_t node);
+    void insertLeaf(int32_t leaf);
+    void removeLeaf(int32_t leaf);
+    int32_t balance(int32_t node);
+
+    /**
+     * @brief Refit bounds and heights from node up to root, balancing on the way.
+     */
+    void refit(int32_t node);
+
+public:
+    BoundingVolumeHierarchy(float margin = 0.1f);
+
+    /**
+     * @brief Insert a new proxy box with associated user id.
+     * @return proxy index used to move/destroy proxy
+     */
+    int32_t createProxy(const BoundingBox& bounds, uint32_t userId);
+
+    /**
+     * @brief Remove proxy from tree.
+     */
+    void destroyProxy(int32_t proxy);
+
+    /**
+     * @brief Update proxy box, tree is only modified if box moved outside proxy fat box.
+     * @return true if proxy was reinserted
+     */
+    bool moveProxy(int32_t proxy, const BoundingBox& bounds);
+
+    /**
+     * @brief User id associated with proxy.
+     */
+    uint32_t getUserId(int32_t proxy) const
+    {
+        return _nodes[proxy].userId;
+    }
+
+    /**
+     * @brief Change user id associated with proxy.
+     */
+    void setUserId(int32_t proxy, uint32_t userId)
+    {
+        _nodes[proxy].userId = userId;
+    }
+
+    /**
+     * @brief Enlarged proxy box stored in tree.
+     */
+    const BoundingBox& getFatBounds(int32_t proxy) const
+    {
+        return _nodes[proxy].bounds;
+    }
+
+    /**
+     * @brief Number of proxies in tree.
+     */
+    size_t size() const
+    {
+        return _proxyCount;
+    }
+
+    /**
+     * @brief Tree height (0 for empty or single proxy tree).
+     */
+    int32_t getHeight() const
+    {
+        return _root == NullNode ? 0 : _nodes[_root].height;
+    }
+
+    /**
+     * @brief Traverse tree nodes whose boxes pass overlap test and invoke callback for leaves.
+     *
+     * Overlap is a bool(const BoundingBox&) test, callback is bool(int32_t proxy) and returns
+     * false to stop traversal.
+     */
+    template <typename Overlap, typename Callback>
+    void query(Overlap&& overlap, Callback&& callback) const
+    {
+        if (_root == NullNode) {
+            return;
+        }
+
+        // tree is balanced so stack depth is bounded by height, use a small fixed stack when
+        // possible to avoid allocating per query
+        int32_t fixedStack[64];
+        std::vector<int32_t> dynamicStack;
+        int32_t* stack = fixedStack;
+        size_t stackCapacity = 64;
+        if (static_cast<size_t>(_nodes[_root].height) + 2 > stackCapacity) {
+            dynamicStack.resize(_nodes[_root].height + 2);
+            stack = dynamicStack.data();
+            stackCapacity = dynamicStack.size();
+        }
+
+        size_t stackSize = 0;
+        stack[stackSize++] = _root;
+        while (stackSize > 0) {
+            auto& node = _nodes[stack[--stackSize]];
+            if (!overlap(node.bounds)) {
+                continue;
+            }
+
+            if (node.isLeaf()) {
+                if (!callback(static_cast<int32_t>(&node - _nodes.data()))) {
+                    return;
+                }
+            }
+            else {
+                stack[stackSize++] = node.child1;
+                stack[stackSize++] = node.child2;
+            }
+        }
+    }
+};
+}
+}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+
+namespace ipp {
+namespace scene {
+namespace spatial {
+
+/**
+ * @brief Axis aligned bounding box, default constructed box is empty (min > max).
+ */
+struct BoundingBox {
+    glm::vec3 min{std::numeric_limits<float>::max()};
+    glm::vec3 max{-std::numeric_limits<float>::max()};
+
+    BoundingBox() = default;
+
+    BoundingBox(const glm::vec3& min, const glm::vec3& max)
+        : min{min}
+        , max{max}
+    {
+    }
+
+    /**
+     * @brief Is box empty (contains no points).
+     */
+    bool isEmpty() const
+    {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    /**
+     * @brief Is other box completely inside this box.
+     */
+    bool contains(const BoundingBox& other) const
+    {
+        return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+               max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+    }
+
+    /**
+     * @brief Do boxes intersect (touching boxes are considered overlapping).
+     */
+    bool overlaps(const BoundingBox& other) const
+    {
+        return min.x <= other.max.x && min.y <= other.max.y && min.z <= other.max.z &&
+               max.x >= other.min.x && max.y >= other.min.y && max.z >= other.min.z;
+    }
+
+    /**
+     * @brief Surface area of box used as BVH insertion cost metric.
+     */
+    float getSurfaceArea() const
+    {
+        auto extent = max - min;
+        return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+    }
+
+    /**
+     * @brief Smallest box that contains both this and other box.
+     */
+    BoundingBox merge(const BoundingBox& other) const
+    {
+        return {glm::min(min, other.min), glm::max(max, other.max)};
+    }
+
+    /**
+     * @brief Box grown by margin in every direction.
+     */
+    BoundingBox expand(float margin) const
+    {
+        return {min - glm::vec3(margin), max + glm::vec3(margin)};
+    }
+
+    /**
+     * @brief Bounding box of this box transformed by affine matrix.
+     */
+    BoundingBox transform(const glm::mat4& matrix) const;
+};
+
+/**
+ * @brief Half-line with origin and normalized direction.
+ */
+struct Ray {
+    glm::vec3 origin;
+    glm::vec3 direction;
+
+    /**
+     * @brief Create a ray from normalized device coordinate point trough inverse view projection.
+     */
+    static Ray FromViewport(const glm::vec2& point, const glm::mat4& inverseViewProjection);
+
+    /**
+     * @brief Intersect ray with box (slab test).
+     * @return true if ray hits box closer than maxDistance, distance is set to entry distance
+     *         (0 if origin is inside box)
+     */
+    bool intersect(const BoundingBox& box, float maxDistance, float& distance) const;
+};
+
+/**
+ * @brief View frustum defined by 6 planes extracted from a view projection matrix.
+ */
+struct Frustum {
+    /**
+     * @brief Plane equations (normal xyz, distance w) with normals pointing inside frustum.
+     */
+    std::array<glm::vec4, 6> planes;
+
+    Frustum(const glm::mat4& viewProjection);
+
+    /**
+     * @brief Conservative box test, returns false only if box is completely outside a plane.
+     */
+    bool intersects(const BoundingBox& box) const;
+};
+}
+}
+}
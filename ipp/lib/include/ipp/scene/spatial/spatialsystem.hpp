@@ -0,0 +1,144 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/loop/system.hpp>
+#include <ipp/entity/worldentityobserver.hpp>
+#include <ipp/schema/primitive_generated.h>
+#include <ipp/schema/message/spatial_generated.h>
+#include "bounds.hpp"
+#include "boundingvolumehierarchy.hpp"
+
+namespace ipp {
+namespace scene {
+namespace spatial {
+
+/**
+ * @brief Scene Loop system that keeps a BVH of Node entity world bounds for spatial queries.
+ *
+ * Every Entity with a NodeComponent is tracked, entity bounds are RenderableComponent mesh
+ * bounds transformed by node transform matrix (or node position if entity has no mesh). Bounds
+ * are only recomputed for nodes whose transform matrix changed and the tree is only modified
+ * when bounds move outside of proxy enlarged box.
+ */
+class SpatialSystem final : public loop::SystemT<SpatialSystem> {
+public:
+    /**
+     * @brief Command to pick closest entity under a viewport point.
+     */
+    typedef loop::CommandT<ipp::schema::message::spatial::SpatialPick> PickCommand;
+
+    /**
+     * @brief Event dispatched with PickCommand result.
+     */
+    typedef loop::EventT<ipp::schema::message::spatial::SpatialPicked> PickedEvent;
+
+    /**
+     * @brief Command to find entities overlapping a world space box.
+     */
+    typedef loop::CommandT<ipp::schema::message::spatial::SpatialBoxQuery> BoxQueryCommand;
+
+    /**
+     * @brief Event dispatched for every BoxQueryCommand result entity.
+     */
+    typedef loop::EventT<ipp::schema::message::spatial::SpatialBoxQueryResult>
+        BoxQueryResultEvent;
+
+private:
+    /**
+     * @brief Tracked Node entity, index in entity array is used as BVH proxy user id.
+     */
+    struct SpatialEntity {
+        entity::Entity* entity;
+        node::NodeComponent* node;
+        render::RenderableComponent* renderable;
+        int32_t proxy;
+        BoundingBox bounds;
+        uint32_t transformVersion;
+    };
+
+    /**
+     * @brief Forwards World Entity changes to SpatialSystem.
+     */
+    class SpatialEntityObserver final : public entity::WorldEntityObserver {
+    private:
+        SpatialSystem& _spatialSystem;
+
+        void onEntityComponentsModified(entity::Entity& entity) override;
+        void onWorldEntityRemoving(entity::Entity& entity) override;
+
+    public:
+        SpatialEntityObserver(entity::World& world, SpatialSystem& spatialSystem);
+    };
+
+    camera::CameraSystem* _cameraSystem;
+    render::RenderSystem* _renderSystem;
+    BoundingVolumeHierarchy _tree;
+    std::vector<SpatialEntity> _entities;
+    std::unordered_map<uint32_t, size_t> _entityIndices;
+
+    /**
+     * @brief Start tracking Entity or refresh it's component references.
+     */
+    void updateEntity(entity::Entity& entity);
+
+    /**
+     * @brief Stop tracking Entity.
+     */
+    void removeEntity(entity::Entity& entity);
+
+    /**
+     * @brief World bounds of entity from current node transform.
+     */
+    BoundingBox computeBounds(const SpatialEntity& spatialEntity) const;
+
+    /**
+     * @brief System initialization implementation.
+     */
+    std::vector<SystemBase*> initialize() override;
+
+    /**
+     * @brief Handle pick and box query commands.
+     */
+    void onMessage(const loop::Message& message) override;
+
+    /**
+     * @brief Update bounds of entities whose node transform changed.
+     */
+    void onUpdate() override;
+
+public:
+    SpatialSystem(loop::MessageLoop& messageLoop, entity::World& world);
+
+    /**
+     * @brief Find closest visible entity whose bounds are hit by ray.
+     * @return entity id or 0 if no entity was hit, distance is set to hit distance
+     */
+    uint32_t raycast(const Ray& ray, float maxDistance, float& distance) const;
+
+    /**
+     * @brief Find closest visible entity under viewport point trough active camera.
+     * @note Point must be in normalized device coordinates ([-1, -1] bottom left of viewport).
+     */
+    uint32_t pick(const glm::vec2& point, float& distance) const;
+
+    /**
+     * @brief Append ids of entities whose bounds overlap box.
+     */
+    void queryBox(const BoundingBox& box, std::vector<uint32_t>& entityIds) const;
+
+    /**
+     * @brief Append ids of entities whose bounds intersect frustum.
+     */
+    void queryFrustum(const Frustum& frustum, std::vector<uint32_t>& entityIds) const;
+
+    /**
+     * @brief Bounding volume hierarchy of tracked entities.
+     */
+    const BoundingVolumeHierarchy& getTree() const
+    {
+        return _tree;
+    }
+};
+}
+}
+}
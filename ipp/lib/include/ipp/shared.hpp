@@ -9,6 +9,8 @@
 #include <unordered_set>
 #include <chrono>
 #include <cmath>
+#include <cstring>
+#include <limits>
 #include <functional>
 #include <algorithm>
 #include <typeinfo>
@@ -66,11 +68,20 @@ class Command;
 class MessageLoop;
 }
 
+// task scheduling
+namespace task {
+class TaskGroup;
+class ThreadPool;
+class TaskGraph;
+}
+
 // entity-component system
 namespace entity {
 class Entity;
 class WorldEntityObserver;
 class World;
+class WorldSnapshot;
+class EntityCommandBuffer;
 
 class ComponentBase;
 template <typename T>
@@ -111,6 +122,12 @@ class RenderPassContext;
 class RenderSystem;
 }
 
+// scene spatial queries
+namespace spatial {
+class BoundingVolumeHierarchy;
+class SpatialSystem;
+}
+
 // scene node hierarchy/transform system
 namespace node {
 class Node;
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include "threadpool.hpp"
+
+namespace ipp {
+namespace task {
+
+/**
+ * @brief Split [begin, end) range in to chunks of grainSize and invoke function(chunkBegin,
+ *        chunkEnd) for every chunk on ThreadPool, blocks until all chunks complete.
+ *
+ * Calling thread processes the first chunk. On serial pool (or if range fits in a single chunk)
+ * function is invoked once with the whole range on calling thread.
+ *
+ * @note function must be safe to invoke concurrently for disjoint ranges.
+ */
+template <typename Function>
+void parallelFor(ThreadPool& pool, size_t begin, size_t end, size_t grainSize, Function function)
+{
+    if (end <= begin) {
+        return;
+    }
+
+    grainSize = std::max<size_t>(grainSize, 1);
+    if (pool.isSerial() || end - begin <= grainSize) {
+        function(begin, end);
+        return;
+    }
+
+    TaskGroup group;
+    for (auto chunkBegin = begin + grainSize; chunkBegin < end; chunkBegin += grainSize) {
+        auto chunkEnd = std::min(end, chunkBegin + grainSize);
+        pool.submit(group, [&function, chunkBegin, chunkEnd]() { function(chunkBegin, chunkEnd); });
+    }
+
+    try {
+        function(begin, begin + grainSize);
+    }
+    catch (...) {
+        // chunk tasks reference function and group, they must finish before unwinding
+        try {
+            pool.wait(group);
+        }
+        catch (...) {
+        }
+        throw;
+    }
+    pool.wait(group);
+}
+
+/**
+ * @brief Invoke function(element) for every element of a random access container in parallel.
+ *
+ * Works with any contiguous range such as EntityGroupWithFilter::getEntities().
+ */
+template <typename Container, typename Function>
+void parallelForEach(ThreadPool& pool, Container& container, size_t grainSize, Function function)
+{
+    parallelFor(pool, 0, container.size(), grainSize,
+                [&container, &function](size_t chunkBegin, size_t chunkEnd) {
+                    for (auto i = chunkBegin; i < chunkEnd; ++i) {
+                        function(container[i]);
+                    }
+                });
+}
+}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/noncopyable.hpp>
+#include "threadpool.hpp"
+
+namespace ipp {
+namespace task {
+
+/**
+ * @brief Directed acyclic graph of tasks executed on ThreadPool.
+ *
+ * Task is submitted for execution once all tasks it depends on have completed.
+ * Graph can be executed multiple times, dependencies are resolved again on every run.
+ *
+ * On a serial ThreadPool tasks are executed in a deterministic topological order - tasks with
+ * resolved dependencies execute in order they were added to graph.
+ */
+class TaskGraph final : public NonCopyable {
+public:
+    typedef size_t TaskId;
+
+private:
+    struct Node {
+        ThreadPool::Task task;
+        std::vector<TaskId> successors;
+        size_t dependencyCount;
+        std::atomic<size_t> unresolved;
+    };
+
+    std::vector<std::unique_ptr<Node>> _nodes;
+
+    /**
+     * @brief Submit node task, once task completes resolve dependant nodes and submit them.
+     */
+    void submitNode(ThreadPool& pool, TaskGroup& group, TaskId id);
+
+    /**
+     * @brief Return nodes in topological order, throws logic_error if graph contains a cycle.
+     */
+    std::vector<TaskId> sortTopological() const;
+
+public:
+    /**
+     * @brief Add a task node to graph.
+     */
+    TaskId addTask(ThreadPool::Task task);
+
+    /**
+     * @brief Make task execution wait for dependency task to complete.
+     */
+    void addDependency(TaskId task, TaskId dependency);
+
+    /**
+     * @brief Execute all graph tasks and block until they complete.
+     */
+    void run(ThreadPool& pool);
+
+    /**
+     * @brief Number of tasks in graph.
+     */
+    size_t size() const
+    {
+        return _nodes.size();
+    }
+};
+}
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <ipp/shared.hpp>
+#include <ipp/noncopyable.hpp>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+namespace ipp {
+namespace task {
+
+/**
+ * @brief Tracks completion of a set of tasks submitted to ThreadPool.
+ *
+ * TaskGroup must outlive every task submitted with it, use ThreadPool::wait before destroying it.
+ */
+class TaskGroup final : public NonCopyable {
+public:
+    friend class ThreadPool;
+
+private:
+    std::atomic<size_t> _pending;
+    std::mutex _exceptionMutex;
+    std::exception_ptr _exception;
+
+public:
+    TaskGroup()
+        : _pending{0}
+    {
+    }
+
+    /**
+     * @brief True when all tasks submitted with this group have finished executing.
+     */
+    bool isComplete() const
+    {
+        return _pending.load(std::memory_order_acquire) == 0;
+    }
+};
+
+/**
+ * @brief Work stealing thread pool.
+ *
+ * Every worker thread owns a task queue, tasks submitted from a worker go to the back of it's own
+ * queue and are popped LIFO, idle workers steal from the front of other worker queues.
+ * Tasks submitted from non-worker threads are distributed round-robin.
+ *
+ * Threads waiting for a TaskGroup execute queued tasks while waiting so nested parallelism can't
+ * deadlock the pool.
+ *
+ * ThreadPool created with 0 workers is serial - tasks execute immediately on submitting thread
+ * in submission order, this is deterministic and is the only mode available without thread
+ * support (Emscripten).
+ */
+class ThreadPool final : public NonCopyable {
+public:
+    typedef std::function<void()> Task;
+
+private:
+    struct Entry {
+        Task task;
+        TaskGroup* group;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Entry> entries;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::atomic<size_t> _queuedCount;
+    std::atomic<size_t> _nextWorker;
+    std::mutex _sleepMutex;
+    std::condition_variable _sleepCondition;
+    bool _stopping;
+
+    /**
+     * @brief Worker thread entry point.
+     */
+    void workerMain(size_t workerIndex);
+
+    /**
+     * @brief Pop a task from worker queue (back) or steal from other worker queues (front).
+     * @return false if no task could be found in any queue
+     */
+    bool popEntry(size_t workerIndex, Entry& entry);
+
+    /**
+     * @brief Execute entry task and signal it's group.
+     */
+    static void execute(Entry& entry);
+
+public:
+    /**
+     * @brief Create a thread pool with workerCount threads, 0 creates a serial pool.
+     */
+    explicit ThreadPool(size_t workerCount);
+    ~ThreadPool();
+
+    /**
+     * @brief Number of worker threads (calling thread not included).
+     */
+    size_t getWorkerCount() const
+    {
+        return _workers.size();
+    }
+
+    /**
+     * @brief Serial pool executes all tasks on submitting thread.
+     */
+    bool isSerial() const
+    {
+        return _workers.empty();
+    }
+
+    /**
+     * @brief Queue task for execution as part of group.
+     */
+    void submit(TaskGroup& group, Task task);
+
+    /**
+     * @brief Execute a single queued task on calling thread.
+     * @return false if no queued task was found
+     */
+    bool runPendingTask();
+
+    /**
+     * @brief Block until all group tasks complete, executing queued tasks while waiting.
+     *
+     * Rethrows first exception thrown by a group task.
+     */
+    void wait(TaskGroup& group);
+
+    /**
+     * @brief Default worker count for current platform, hardware threads - 1 (calling thread).
+     */
+    static size_t GetDefaultWorkerCount();
+};
+}
+}
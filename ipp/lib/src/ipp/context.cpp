@@ -3,14 +3,40 @@
 using namespace std;
 using namespace ipp;
 
+namespace {
+/**
+ * @brief ThreadPool worker count from "task" configuration section.
+ */
+size_t getConfigurationWorkerCount(const json& configuration)
+{
+    auto taskIt = configuration.find("task");
+    if (taskIt == configuration.end()) {
+        return 0;
+    }
+
+    auto workerCountIt = taskIt->find("workerCount");
+    if (workerCountIt == taskIt->end() || !workerCountIt->is_number()) {
+        return 0;
+    }
+
+    int workerCount = *workerCountIt;
+    if (workerCount < 0) {
+        return task::ThreadPool::GetDefaultWorkerCount();
+    }
+    return static_cast<size_t>(workerCount);
+}
+}
+
 Context::Context(json configuration)
     : _configuration{configuration}
+    , _threadPool{getConfigurationWorkerCount(_configuration)}
     , _resourceManager(*this)
 {
 }
 
 unique_ptr<scene::Scene> Context::createScene(const string& resourcePath)
 {
-    auto data = _resourceManager.requestResourceData(resourcePath);
+    // scene retains its data, animation channels are evaluated in place
+    auto data = _resourceManager.requestResourceData(resourcePath, true);
     return make_unique<scene::Scene>(*this, move(data));
 }
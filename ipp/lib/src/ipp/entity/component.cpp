@@ -1,8 +1,20 @@
 #include <flatbuffers/flatbuffers.h>
 #include <ipp/entity/entity.hpp>
+#include <ipp/entity/world.hpp>
 #include <ipp/log.hpp>
 
 using namespace std;
 using namespace ipp::entity;
 
 uint32_t ComponentBase::ComponentTypeIdCounter = 0;
+
+ComponentBase::ComponentBase(Entity& entity)
+    : _entity{entity}
+    , _changeVersion{entity.getWorld().getFrame()}
+{
+}
+
+void ComponentBase::markDirty()
+{
+    _changeVersion = _entity.getWorld().getFrame();
+}
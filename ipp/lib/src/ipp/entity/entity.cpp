@@ -3,6 +3,14 @@
 using namespace std;
 using namespace ipp::entity;
 
+Entity::~Entity()
+{
+    for (auto it = _componentBuffer.rbegin(); it != _componentBuffer.rend(); ++it) {
+        auto component = *it;
+        _world.findComponentPool(component->getComponentTypeId())->destroy(component);
+    }
+}
+
 void Entity::dispatchComponentsModified()
 {
     _world.onEntityComponentsModified(*this);
@@ -17,7 +25,7 @@ ComponentBase* Entity::findComponent(uint32_t componentTypeId) const
     if (componentIt == _componentBuffer.end()) {
         return nullptr;
     }
-    return componentIt->get();
+    return *componentIt;
 }
 
 ComponentBase* Entity::findComponent(const std::string& componentTypeName) const
@@ -29,7 +37,7 @@ ComponentBase* Entity::findComponent(const std::string& componentTypeName) const
     if (componentIt == _componentBuffer.end()) {
         return nullptr;
     }
-    return componentIt->get();
+    return *componentIt;
 }
 
 /**
@@ -40,13 +48,18 @@ void Entity::removeComponent(ComponentBase* component)
     assert(component != nullptr);
     assert(&component->getEntity() == this);
 
-    auto componentIt = std::find_if(
-        _componentBuffer.begin(), _componentBuffer.end(),
-        [component](auto& componentInstance) { return componentInstance.get() == component; });
-
+    auto componentIt = std::find(_componentBuffer.begin(), _componentBuffer.end(), component);
     assert(componentIt != _componentBuffer.end());
 
-    auto componentInstance = std::move(*componentIt);
+    // component is released to pool after observers are notified so references to it stay valid
+    // during onEntityComponentsModified
     _componentBuffer.erase(componentIt);
-    dispatchComponentsModified();
+    try {
+        dispatchComponentsModified();
+    }
+    catch (...) {
+        _world.findComponentPool(component->getComponentTypeId())->destroy(component);
+        throw;
+    }
+    _world.findComponentPool(component->getComponentTypeId())->destroy(component);
 }
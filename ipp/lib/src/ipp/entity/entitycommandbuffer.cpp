@@ -0,0 +1,75 @@
+#include <ipp/entity/entitycommandbuffer.hpp>
+#include <ipp/entity/world.hpp>
+#include <ipp/log.hpp>
+#include <algorithm>
+#include <iterator>
+
+using namespace std;
+using namespace ipp::entity;
+
+void EntityCommandBuffer::apply(World& world)
+{
+    apply(world, {this});
+}
+
+void EntityCommandBuffer::apply(World& world, const vector<EntityCommandBuffer*>& buffers)
+{
+    // commands are moved out before applying so observers can record new commands while applying
+    vector<Command> commands;
+    for (auto buffer : buffers) {
+        move(buffer->_commands.begin(), buffer->_commands.end(), back_inserter(commands));
+        buffer->_commands.clear();
+    }
+
+    // buffers are recorded concurrently, merged commands are applied in recording order
+    stable_sort(commands.begin(), commands.end(), [](const Command& a, const Command& b) {
+        return a.sequence < b.sequence;
+    });
+
+    for (auto& command : commands) {
+        try {
+            applyCommand(world, command);
+        }
+        catch (const exception& exception) {
+            IVL_LOG(Error, "Deferred command for Entity with ID {} failed : {}", command.entityId,
+                    exception.what());
+        }
+    }
+}
+
+void EntityCommandBuffer::applyCommand(World& world, Command& command)
+{
+    if (command.kind == CommandKind::CreateEntity) {
+        world.createEntity(command.entityId, move(command.entityName));
+        return;
+    }
+
+    auto entity = world.findEntity(command.entityId);
+    if (entity == nullptr) {
+        IVL_LOG(Error, "Unable to find Entity with ID {} for deferred command", command.entityId);
+        return;
+    }
+
+    switch (command.kind) {
+        case CommandKind::RemoveEntity:
+            world.removeEntity(command.entityId);
+            break;
+
+        case CommandKind::CreateComponent:
+            command.createComponent(*entity);
+            break;
+
+        case CommandKind::RemoveComponent:
+            if (auto component = entity->findComponent(command.componentTypeId)) {
+                entity->removeComponent(component);
+            }
+            else {
+                IVL_LOG(Error, "Unable to find Component type {} in Entity {} for deferred command",
+                        command.componentTypeId, entity->getName());
+            }
+            break;
+
+        case CommandKind::CreateEntity:
+            break;
+    }
+}
@@ -0,0 +1,90 @@
+#include <ipp/entity/entitystorage.hpp>
+
+using namespace std;
+using namespace ipp::entity;
+
+constexpr size_t EntityStorage::EntityPageSize;
+constexpr size_t EntityStorage::IndexPageSize;
+
+EntityStorage::EntityStorage()
+    : _lastPageUsed{0}
+{
+}
+
+EntityStorage::~EntityStorage()
+{
+    for (auto entity : _entities) {
+        entity->~Entity();
+    }
+}
+
+uint32_t& EntityStorage::requireIndexSlot(uint32_t id)
+{
+    auto page = id / IndexPageSize;
+    if (page >= _indexPages.size()) {
+        _indexPages.resize(page + 1);
+    }
+    if (!_indexPages[page]) {
+        _indexPages[page] = unique_ptr<uint32_t[]>(new uint32_t[IndexPageSize]());
+    }
+    return _indexPages[page][id % IndexPageSize];
+}
+
+EntityStorage::EntitySlot* EntityStorage::allocateSlot()
+{
+    if (!_freeSlots.empty()) {
+        auto slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        return slot;
+    }
+
+    if (_entityPages.empty() || _lastPageUsed == EntityPageSize) {
+        _entityPages.emplace_back(new EntitySlot[EntityPageSize]);
+        _lastPageUsed = 0;
+    }
+    return &_entityPages.back()[_lastPageUsed++];
+}
+
+Entity* EntityStorage::create(World& world, uint32_t id, string name)
+{
+    auto& indexSlot = requireIndexSlot(id);
+    assert(indexSlot == 0);
+
+    auto storage = allocateSlot();
+    Entity* entity;
+    try {
+        entity = new (storage) Entity(world, id, move(name));
+    }
+    catch (...) {
+        _freeSlots.push_back(storage);
+        throw;
+    }
+
+    _entities.push_back(entity);
+    indexSlot = static_cast<uint32_t>(_entities.size());
+    return entity;
+}
+
+bool EntityStorage::remove(uint32_t id)
+{
+    auto indexSlot = findIndexSlot(id);
+    if (indexSlot == nullptr || *indexSlot == 0) {
+        return false;
+    }
+
+    auto index = *indexSlot - 1;
+    auto entity = _entities[index];
+
+    // move last entity in to removed entity dense position
+    auto last = _entities.back();
+    if (last != entity) {
+        _entities[index] = last;
+        *findIndexSlot(last->getId()) = index + 1;
+    }
+    _entities.pop_back();
+    *indexSlot = 0;
+
+    entity->~Entity();
+    _freeSlots.push_back(reinterpret_cast<EntitySlot*>(entity));
+    return true;
+}
@@ -6,6 +6,7 @@ using namespace ipp::entity;
 
 void World::onEntityComponentsModified(Entity& entity)
 {
+    _structureVersion++;
     for (auto& observer : _entityObservers) {
         observer->onEntityComponentsModified(entity);
     }
@@ -21,7 +22,7 @@ Entity* World::createEntity(uint32_t id, string entityName)
         IVL_LOG_THROW_ERROR(invalid_argument, "Entity name cannot be empty");
     }
 
-    if (_entities.find(id) != _entities.end()) {
+    if (_entities.find(id) != nullptr) {
         IVL_LOG_THROW_ERROR(runtime_error, "Entity : {} with same id : {} already exists in World",
                             entityName, id);
     }
@@ -37,10 +38,8 @@ Entity* World::createEntity(uint32_t id, string entityName)
         _maxEntityId = id;
     }
 
-    auto entity = make_unique<Entity>(*this, id, move(entityName));
-    auto result = entity.get();
-
-    _entities.emplace(id, move(entity));
+    auto result = _entities.create(*this, id, move(entityName));
+    _structureVersion++;
 
     for (auto& observer : _entityObservers) {
         observer->onWorldEntityCreated(*result);
@@ -51,28 +50,70 @@ Entity* World::createEntity(uint32_t id, string entityName)
 
 bool World::removeEntity(uint32_t id)
 {
-    auto it = _entities.find(id);
-    if (it == _entities.end()) {
+    auto entity = _entities.find(id);
+    if (entity == nullptr) {
         return false;
     }
 
     for (auto& observer : _entityObservers) {
-        observer->onWorldEntityRemoving(*it->second);
+        observer->onWorldEntityRemoving(*entity);
     }
 
-    _entities.erase(it);
-
-    return true;
+    _structureVersion++;
+    return _entities.remove(id);
 }
 
 Entity* World::findEntity(const string& name) const
 {
     auto it = find_if(_entities.begin(), _entities.end(),
-                      [&name](auto& entity) { return entity.second->getName() == name; });
+                      [&name](auto entity) { return entity->getName() == name; });
     if (it == _entities.end()) {
         return nullptr;
     }
     else {
-        return it->second.get();
+        return *it;
+    }
+}
+
+vector<ComponentPoolBase::Statistics> World::getComponentPoolStatistics() const
+{
+    vector<ComponentPoolBase::Statistics> result;
+    for (auto& pool : _componentPools) {
+        if (pool) {
+            result.push_back(pool->getStatistics());
+        }
     }
+    return result;
+}
+
+EntityCommandBuffer& World::getCommandBuffer()
+{
+    auto threadId = this_thread::get_id();
+
+    lock_guard<mutex> lock(_commandBuffersMutex);
+    auto it = find_if(_commandBuffers.begin(), _commandBuffers.end(),
+                      [threadId](auto& buffer) { return buffer.first == threadId; });
+    if (it != _commandBuffers.end()) {
+        return *it->second;
+    }
+
+    _commandBuffers.emplace_back(threadId, make_unique<EntityCommandBuffer>(&_commandSequence));
+    return *_commandBuffers.back().second;
+}
+
+void World::applyCommandBuffers()
+{
+    // buffers are never released so pointers can be applied without holding the lock, this way
+    // observers can record new commands (in to a new buffer) while commands are being applied
+    vector<EntityCommandBuffer*> buffers;
+    {
+        lock_guard<mutex> lock(_commandBuffersMutex);
+        for (auto& buffer : _commandBuffers) {
+            if (!buffer.second->isEmpty()) {
+                buffers.push_back(buffer.second.get());
+            }
+        }
+    }
+
+    EntityCommandBuffer::apply(*this, buffers);
 }
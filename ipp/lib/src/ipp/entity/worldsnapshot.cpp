@@ -0,0 +1,61 @@
+#include <ipp/entity/worldsnapshot.hpp>
+#include <ipp/entity/world.hpp>
+#include <ipp/log.hpp>
+
+using namespace std;
+using namespace ipp::entity;
+
+WorldSnapshot::WorldSnapshot()
+    : _structureVersion{0}
+    , _world{nullptr}
+{
+}
+
+void WorldSnapshot::capture(const World& world)
+{
+    _world = &world;
+    _structureVersion = world.getStructureVersion();
+    _buffer.clear();
+
+    for (auto entity : world.getEntities()) {
+        for (auto component : entity->getComponentBuffer()) {
+            auto size = component->getSnapshotSize();
+            if (size == 0) {
+                continue;
+            }
+
+            auto offset = _buffer.size();
+            _buffer.resize(offset + size);
+            component->writeSnapshot(_buffer.data() + offset);
+        }
+    }
+}
+
+void WorldSnapshot::restore(World& world) const
+{
+    if (!isValidFor(world)) {
+        IVL_LOG_THROW_ERROR(logic_error, "World snapshot structure version {} does not match World "
+                                         "structure version {}",
+                            _structureVersion, world.getStructureVersion());
+    }
+
+    auto data = _buffer.data();
+    for (auto entity : world.getEntities()) {
+        for (auto component : entity->getComponentBuffer()) {
+            auto size = component->getSnapshotSize();
+            if (size == 0) {
+                continue;
+            }
+
+            component->readSnapshot(data);
+            component->markDirty();
+            data += size;
+        }
+    }
+    assert(data == _buffer.data() + _buffer.size());
+}
+
+bool WorldSnapshot::isValidFor(const World& world) const
+{
+    return _world == &world && _structureVersion == world.getStructureVersion();
+}
@@ -123,6 +123,11 @@ MessageLoop::EventListener* MessageLoop::createListener(
     return listener;
 }
 
+void MessageLoop::registerSyncCallback(function<void()> callback)
+{
+    _syncCallbacks.push_back(move(callback));
+}
+
 void MessageLoop::releaseListener(EventListener* listener)
 {
     auto listenerIt = find_if(_eventListeners.begin(), _eventListeners.end(),
@@ -264,9 +269,18 @@ void MessageLoop::update()
 
     // clear queue when finished dispatching all messages
     _messageQueueProcessing->clear();
+    synchronize();
 
     // update all systems
     for (auto& system : _systems) {
         system->onUpdate();
+        synchronize();
+    }
+}
+
+void MessageLoop::synchronize()
+{
+    for (auto& callback : _syncCallbacks) {
+        callback();
     }
 }
@@ -1,5 +1,6 @@
 #include <ipp/log.hpp>
 #include <ipp/render/armature.hpp>
+#include <ipp/render/transformkernel.hpp>
 #include <ipp/schema/primitive_generated.h>
 #include <ipp/schema/resource/render/armature_generated.h>
 
@@ -28,7 +29,28 @@ Armature::Bone::Pose::Pose(vec3 translation, quat rotation, float scale)
 
 Armature::Bone::Pose::operator mat4() const
 {
-    return translate(translation) * toMat4(rotation) * ::glm::scale(vec3(scale));
+    mat4 matrix;
+    composeQuaternionTransformMatrix(translation, rotation, vec3(scale), matrix);
+    return matrix;
+}
+
+void Armature::Bone::Pose::ComposeMatrices(const Pose* poses, size_t count, mat4* matrices)
+{
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+        vec3 translations[4];
+        quat rotations[4];
+        vec3 scales[4];
+        for (size_t i = 0; i < 4; ++i) {
+            translations[i] = poses[index + i].translation;
+            rotations[i] = poses[index + i].rotation;
+            scales[i] = vec3(poses[index + i].scale);
+        }
+        composeQuaternionTransformMatrices4(translations, rotations, scales, matrices + index);
+    }
+    for (; index < count; ++index) {
+        matrices[index] = static_cast<mat4>(poses[index]);
+    }
 }
 
 Armature::Bone::Bone(string name,
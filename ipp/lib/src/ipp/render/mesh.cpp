@@ -56,6 +56,27 @@ gl::VertexDefinition::AttributeName GetAttributeNameGLEnum(
 #undef ATTRIB_NAME_MAP
 }
 
+/**
+ * @brief Compute bounds of Float x 3 vertex positions at positionOffset in interleaved buffer.
+ */
+void computeBounds(const flatbuffers::Vector<uint8_t>& buffer,
+                   size_t vertexSize,
+                   size_t positionOffset,
+                   glm::vec3& boundsMin,
+                   glm::vec3& boundsMax)
+{
+    boundsMin = glm::vec3(0);
+    boundsMax = glm::vec3(0);
+
+    auto vertexCount = buffer.size() / vertexSize;
+    for (size_t i = 0; i < vertexCount; ++i) {
+        glm::vec3 position;
+        memcpy(&position, buffer.data() + i * vertexSize + positionOffset, sizeof(float) * 3);
+        boundsMin = i == 0 ? position : glm::min(boundsMin, position);
+        boundsMax = i == 0 ? position : glm::max(boundsMax, position);
+    }
+}
+
 Mesh::Binding::Binding(Mesh& mesh)
     : _mesh{&mesh}
     , _vertexBinding{mesh.getVertexBuffer()}
@@ -91,6 +112,8 @@ Mesh::Mesh(unique_ptr<ResourceBuffer> data)
 
     // load vertex definition
     size_t vertexSize = 0;
+    size_t positionOffset = 0;
+    bool hasFloatPosition = false;
     vector<gl::VertexDefinition::AttributeDefinition> vertexAttributes;
     for (const auto attrib : *vertexData->attributes()) {
         IVL_LOG(Trace, "Mesh vertex attribute definition : {}, index : {}, element type : {}, "
@@ -103,11 +126,37 @@ Mesh::Mesh(unique_ptr<ResourceBuffer> data)
             GetElementTypeGLEnum(attrib->elementType()), attrib->elementCount(),
             attrib->normalized());
         vertexAttributes.push_back(attributeDefinition);
+        if (attrib->name() == schema::resource::render::vertex::AttributeName_Position &&
+            attrib->index() == 0) {
+            positionOffset = vertexSize;
+            hasFloatPosition =
+                attrib->elementType() == schema::resource::render::vertex::ElementType_Float &&
+                attrib->elementCount() == 3;
+        }
         vertexSize += static_cast<size_t>(attributeDefinition.getSize());
     }
     _vertexDefinition = make_unique<gl::VertexDefinition>(vertexAttributes);
     IVL_LOG(Trace, "Mesh vertex size : {}", vertexSize);
 
+    // load bounds exported by pipeline or compute them from float vertex positions
+    if (meshData->boundsMin() && meshData->boundsMax()) {
+        auto boundsMin = meshData->boundsMin();
+        auto boundsMax = meshData->boundsMax();
+        _boundsMin = glm::vec3(boundsMin->x(), boundsMin->y(), boundsMin->z());
+        _boundsMax = glm::vec3(boundsMax->x(), boundsMax->y(), boundsMax->z());
+    }
+    else if (hasFloatPosition && vertexSize > 0) {
+        computeBounds(*vertexData->buffer(), vertexSize, positionOffset, _boundsMin, _boundsMax);
+    }
+    else {
+        IVL_LOG(Warning, "Mesh {} has no Float x 3 position attribute, bounds will be empty",
+                getResourcePath());
+        _boundsMin = glm::vec3(0);
+        _boundsMax = glm::vec3(0);
+    }
+    IVL_LOG(Trace, "Mesh bounds : [{}, {}, {}] - [{}, {}, {}]", _boundsMin.x, _boundsMin.y,
+            _boundsMin.z, _boundsMax.x, _boundsMax.y, _boundsMax.z);
+
     // load vertex buffer
     {
         gl::Binding<gl::ArrayBuffer> binding{_vertexBuffer};
@@ -0,0 +1,92 @@
+#include <ipp/render/transformkernel.hpp>
+
+#ifdef IPP_TRANSFORM_KERNEL_SSE
+#include <xmmintrin.h>
+#endif
+
+using namespace std;
+using namespace glm;
+using namespace ipp::render;
+
+#ifdef IPP_TRANSFORM_KERNEL_SSE
+
+void ipp::render::composeQuaternionTransformMatrices4(const vec3 translations[4],
+                                                      const quat rotations[4],
+                                                      const vec3 scales[4],
+                                                      mat4 matrices[4])
+{
+    // structure of arrays registers, lane i holds transform i
+    auto x = _mm_setr_ps(rotations[0].x, rotations[1].x, rotations[2].x, rotations[3].x);
+    auto y = _mm_setr_ps(rotations[0].y, rotations[1].y, rotations[2].y, rotations[3].y);
+    auto z = _mm_setr_ps(rotations[0].z, rotations[1].z, rotations[2].z, rotations[3].z);
+    auto w = _mm_setr_ps(rotations[0].w, rotations[1].w, rotations[2].w, rotations[3].w);
+    auto scaleX = _mm_setr_ps(scales[0].x, scales[1].x, scales[2].x, scales[3].x);
+    auto scaleY = _mm_setr_ps(scales[0].y, scales[1].y, scales[2].y, scales[3].y);
+    auto scaleZ = _mm_setr_ps(scales[0].z, scales[1].z, scales[2].z, scales[3].z);
+
+    auto one = _mm_set1_ps(1.0f);
+    auto two = _mm_set1_ps(2.0f);
+    auto zero = _mm_setzero_ps();
+
+    auto xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+    auto xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+    auto wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+    // rotation matrix entries mRC (row R, column C) scaled by column scale
+    auto m00 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), scaleX);
+    auto m10 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), scaleX);
+    auto m20 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), scaleX);
+    auto m01 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), scaleY);
+    auto m11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), scaleY);
+    auto m21 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), scaleY);
+    auto m02 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), scaleZ);
+    auto m12 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), scaleZ);
+    auto m22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), scaleZ);
+    auto tx = _mm_setr_ps(translations[0].x, translations[1].x, translations[2].x,
+                          translations[3].x);
+    auto ty = _mm_setr_ps(translations[0].y, translations[1].y, translations[2].y,
+                          translations[3].y);
+    auto tz = _mm_setr_ps(translations[0].z, translations[1].z, translations[2].z,
+                          translations[3].z);
+
+    // transpose lanes back to per transform columns
+    auto column0 = zero;
+    _MM_TRANSPOSE4_PS(m00, m10, m20, column0);
+    auto column1 = zero;
+    _MM_TRANSPOSE4_PS(m01, m11, m21, column1);
+    auto column2 = zero;
+    _MM_TRANSPOSE4_PS(m02, m12, m22, column2);
+    auto column3 = one;
+    _MM_TRANSPOSE4_PS(tx, ty, tz, column3);
+
+    _mm_storeu_ps(&matrices[0][0][0], m00);
+    _mm_storeu_ps(&matrices[1][0][0], m10);
+    _mm_storeu_ps(&matrices[2][0][0], m20);
+    _mm_storeu_ps(&matrices[3][0][0], column0);
+    _mm_storeu_ps(&matrices[0][1][0], m01);
+    _mm_storeu_ps(&matrices[1][1][0], m11);
+    _mm_storeu_ps(&matrices[2][1][0], m21);
+    _mm_storeu_ps(&matrices[3][1][0], column1);
+    _mm_storeu_ps(&matrices[0][2][0], m02);
+    _mm_storeu_ps(&matrices[1][2][0], m12);
+    _mm_storeu_ps(&matrices[2][2][0], m22);
+    _mm_storeu_ps(&matrices[3][2][0], column2);
+    _mm_storeu_ps(&matrices[0][3][0], tx);
+    _mm_storeu_ps(&matrices[1][3][0], ty);
+    _mm_storeu_ps(&matrices[2][3][0], tz);
+    _mm_storeu_ps(&matrices[3][3][0], column3);
+}
+
+#else
+
+void ipp::render::composeQuaternionTransformMatrices4(const vec3 translations[4],
+                                                      const quat rotations[4],
+                                                      const vec3 scales[4],
+                                                      mat4 matrices[4])
+{
+    for (size_t i = 0; i < 4; ++i) {
+        composeQuaternionTransformMatrix(translations[i], rotations[i], scales[i], matrices[i]);
+    }
+}
+
+#endif
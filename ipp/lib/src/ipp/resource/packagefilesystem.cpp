@@ -1,5 +1,6 @@
 #include <ipp/log.hpp>
 #include <ipp/resource/packagefilesystem.hpp>
+#include <ipp/resource/resourcebuffermapped.hpp>
 #include <fstream>
 
 using namespace std;
@@ -13,23 +14,35 @@ PackageFileSystem::PackageFileSystem(ResourceManager& resourceManager,
 {
 }
 
-unique_ptr<ResourceBuffer> PackageFileSystem::requestResourceData(const string& resourcePath)
+unique_ptr<ResourceBuffer> PackageFileSystem::requestResourceData(const string& resourcePath,
+                                                                  bool retained)
 {
     auto resourcePackagePath = resourcePath.substr(resourcePath.find(':') + 1);
     auto filePath = _rootPath + "/" + resourcePackagePath;
     IVL_LOG(Info, "Creating FileSystem resource buffer for resource : {} with file path : {}",
             resourcePath, filePath);
 
+#ifdef IPP_RESOURCE_BUFFER_MAPPED
+    // mapped buffers only load pages that are used, short lived data is read instead
+    if (retained) {
+        auto buffer = make_unique<ResourceBufferMapped>(*this, filePath, filePath);
+        IVL_LOG(Info, "Mapped buffer : {} ({}) size : {}", resourcePath, filePath,
+                buffer->getSize());
+        return buffer;
+    }
+#endif
+
     ifstream file(filePath, ios::binary);
     if (!file) {
         IVL_LOG_THROW_ERROR(runtime_error, "Unable to open resource file : {} with path : {}",
                             resourcePath, filePath);
     }
 
-    vector<char> buffer;
     file.seekg(0, ios::end);
-    buffer.resize(static_cast<size_t>(file.tellg()));
+    auto size = static_cast<size_t>(file.tellg());
     file.seekg(0, ios::beg);
+
+    vector<char> buffer(size);
     file.read(buffer.data(), static_cast<fstream::off_type>(buffer.size()));
     IVL_LOG(Info, "Source buffer : {} ({}) size : {}", resourcePath, filePath, buffer.size());
 
@@ -1,4 +1,5 @@
 #include <ipp/resource/packageipparchive.hpp>
+#include <ipp/resource/resourcebuffermapped.hpp>
 #include <ipp/schema/resource/archive_generated.h>
 #include <fstream>
 
@@ -34,7 +35,8 @@ PackageIPPArchive::PackageIPPArchive(ResourceManager& resourceManager,
     }
 }
 
-unique_ptr<ResourceBuffer> PackageIPPArchive::requestResourceData(const string& resourcePath)
+unique_ptr<ResourceBuffer> PackageIPPArchive::requestResourceData(const string& resourcePath,
+                                                                  bool retained)
 {
     auto resourcePackagePath = resourcePath.substr(resourcePath.find(':') + 1);
     auto fileIt = _files.find(resourcePackagePath);
@@ -44,6 +46,16 @@ unique_ptr<ResourceBuffer> PackageIPPArchive::requestResourceData(const string&
                             resourcePackagePath, _archivePath);
     }
     auto fileDefinition = fileIt->second;
+
+#ifdef IPP_RESOURCE_BUFFER_MAPPED
+    // retained resource data is accessed in place (flatbuffers), map only files aligned for direct
+    // access, short lived data is copied
+    if (retained && fileDefinition.offset % alignof(max_align_t) == 0) {
+        return make_unique<ResourceBufferMapped>(*this, resourcePackagePath, _archivePath,
+                                                 fileDefinition.offset, fileDefinition.size);
+    }
+#endif
+
     vector<char> buffer(fileDefinition.size);
     {
         ifstream archive(_archivePath, ios::binary);
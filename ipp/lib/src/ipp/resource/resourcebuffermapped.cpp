@@ -0,0 +1,97 @@
+#include <ipp/log.hpp>
+#include <ipp/resource/resourcebuffermapped.hpp>
+
+#ifdef IPP_RESOURCE_BUFFER_MAPPED
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace ipp;
+using namespace ipp::resource;
+
+namespace {
+/**
+ * @brief Open file at file path for reading, raises an exception on failure.
+ */
+int openFile(const string& filePath)
+{
+    auto file = open(filePath.c_str(), O_RDONLY);
+    if (file < 0) {
+        IVL_LOG_THROW_ERROR(runtime_error, "Unable to open resource file : {}", filePath);
+    }
+    return file;
+}
+}
+
+ResourceBufferMapped::ResourceBufferMapped(Package& package,
+                                           string resourcePath,
+                                           const string& filePath)
+    : ResourceBuffer(package, move(resourcePath))
+    , _mapping{nullptr}
+    , _mappingSize{0}
+    , _data{nullptr}
+    , _size{0}
+{
+    auto file = openFile(filePath);
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0) {
+        close(file);
+        IVL_LOG_THROW_ERROR(runtime_error, "Unable to read resource file size : {}", filePath);
+    }
+    _size = static_cast<size_t>(fileStatus.st_size);
+    map(file, filePath, 0);
+}
+
+ResourceBufferMapped::ResourceBufferMapped(
+    Package& package, string resourcePath, const string& filePath, size_t offset, size_t size)
+    : ResourceBuffer(package, move(resourcePath))
+    , _mapping{nullptr}
+    , _mappingSize{0}
+    , _data{nullptr}
+    , _size{size}
+{
+    map(openFile(filePath), filePath, offset);
+}
+
+void ResourceBufferMapped::map(int file, const string& filePath, size_t offset)
+{
+    if (_size == 0) {
+        close(file);
+        return;
+    }
+
+    // mapping offset must be page aligned, data starts inside first mapped page
+    auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto mappingOffset = offset - offset % pageSize;
+    _mappingSize = _size + (offset - mappingOffset);
+    _mapping = mmap(nullptr, _mappingSize, PROT_READ, MAP_PRIVATE, file,
+                    static_cast<off_t>(mappingOffset));
+    close(file);
+    if (_mapping == MAP_FAILED) {
+        _mapping = nullptr;
+        IVL_LOG_THROW_ERROR(runtime_error, "Unable to map resource file : {} offset : {} size : {}",
+                            filePath, offset, _size);
+    }
+    _data = static_cast<const char*>(_mapping) + (offset - mappingOffset);
+}
+
+ResourceBufferMapped::~ResourceBufferMapped()
+{
+    if (_mapping != nullptr) {
+        munmap(_mapping, _mappingSize);
+    }
+}
+
+const char* ResourceBufferMapped::getData(size_t offset, size_t length)
+{
+    assert(offset + length <= _size);
+    return _data;
+}
+
+size_t ResourceBufferMapped::getSize() const
+{
+    return _size;
+}
+#endif
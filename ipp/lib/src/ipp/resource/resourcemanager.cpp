@@ -10,7 +10,8 @@ ResourceManager::ResourceManager(Context& context)
 {
 }
 
-unique_ptr<ResourceBuffer> ResourceManager::requestResourceData(const string& resourcePath) const
+unique_ptr<ResourceBuffer> ResourceManager::requestResourceData(const string& resourcePath,
+                                                                bool retained) const
 {
     IVL_LOG(Info, "Requesting resource {} from ResourceManager.", resourcePath);
     auto packageSeparator = resourcePath.find(':');
@@ -32,7 +33,7 @@ unique_ptr<ResourceBuffer> ResourceManager::requestResourceData(const string& re
                             packageName, packageResourcePath);
     }
 
-    return package->requestResourceData(resourcePath);
+    return package->requestResourceData(resourcePath, retained);
 }
 
 void ResourceManager::registerPackage(unique_ptr<Package> package)
@@ -14,9 +14,23 @@ Action::Action(int id, string name, vector<unique_ptr<Channel>> channels)
     IVL_LOG(Trace, "Creating action : {} id : {} channels : {}", _name, _id, _channels.size());
 }
 
-void Action::updateTarget(ipp::Milliseconds time, Channel::Target target) const
+void Action::bind(Channel::Target target) const
 {
     for (auto channelIt = _channels.begin(); channelIt != _channels.end(); ++channelIt) {
-        channelIt->get()->updateTarget(time, target);
+        channelIt->get()->bind(target);
+    }
+}
+
+void Action::updateTarget(ipp::Milliseconds time) const
+{
+    for (auto channelIt = _channels.begin(); channelIt != _channels.end(); ++channelIt) {
+        channelIt->get()->updateTarget(time);
+    }
+}
+
+void Action::reset() const
+{
+    for (auto channelIt = _channels.begin(); channelIt != _channels.end(); ++channelIt) {
+        channelIt->get()->reset();
     }
 }
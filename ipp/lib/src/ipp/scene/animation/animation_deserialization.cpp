@@ -1,3 +1,4 @@
+#include <ipp/context.hpp>
 #include <ipp/log.hpp>
 #include <ipp/scene/render/material.hpp>
 #include <ipp/scene/render/renderablecomponent.hpp>
@@ -8,6 +9,9 @@
 #include <ipp/scene/animation/keyframe.hpp>
 #include <ipp/scene/animation/action.hpp>
 #include <ipp/scene/animation/channel.hpp>
+#include <ipp/scene/animation/vectorchannel.hpp>
+#include <ipp/scene/animation/sampledchannel.hpp>
+#include <ipp/scene/animation/staticchannel.hpp>
 #include <ipp/scene/animation/track.hpp>
 #include <ipp/scene/animation/sequence.hpp>
 #include <ipp/scene/animation/animationsystem.hpp>
@@ -66,15 +70,44 @@ inline mat4 readMat4(const schema::primitive::Mat4* data)
 }
 
 /**
- * @brief Applies channel update value to target Node Component hidden property.
+ * @brief Channel data referencing flatbuffer vector elements in place.
+ *
+ * Scene retains its resource buffer so channels evaluate elements directly from it instead of
+ * copying them, elements are copied on big endian targets (flatbuffer scalars are little endian).
  */
-void updateNodeHidden(bool value, size_t, Channel::Target target)
+template <typename T, typename S>
+ChannelData<T> referenceChannelData(const flatbuffers::Vector<S>* values)
 {
-    auto& entity = target.getEntity();
-    auto node = entity.findComponent<NodeComponent>();
-    node->setHidden(value);
+    static_assert(sizeof(T) == sizeof(S), "Channel data and flatbuffer element sizes must match");
+    if (values == nullptr) {
+        return {};
+    }
+#if FLATBUFFERS_LITTLEENDIAN
+    return ChannelData<T>::Reference(reinterpret_cast<const T*>(values->Data()), values->size());
+#else
+    return vector<T>(values->begin(), values->end());
+#endif
 }
 
+/**
+ * @brief Channel property binding target Node Component hidden property.
+ */
+struct NodeHiddenProperty {
+    typedef NodeComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<NodeComponent>();
+    }
+
+    static void update(bool value, size_t, Binding node)
+    {
+        if (node != nullptr) {
+            node->setHidden(value);
+        }
+    }
+};
+
 /**
  * @brief Read Action animation Channel targeting Entity Node component Hidden property.
  */
@@ -86,148 +119,397 @@ std::unique_ptr<Channel> readActionChannelNodeHidden(
         keyFrames.push_back(ConstKeyFrameT<bool>(chrono::milliseconds(keyFrameData->time()),
                                                  keyFrameData->value()));
     }
-    return make_unique<KeyFrameChannel<bool, ConstKeyFrameT<bool>, &updateNodeHidden>>(0,
-                                                                                       keyFrames);
+    return make_unique<ConstKeyFrameChannel<bool, NodeHiddenProperty>>(0, move(keyFrames));
 }
 
 /**
- * @brief Applies channel update value to target Node Transform.translation property.
+ * @brief Channel property binding target Node Transform vector property V.
  *
- * Property path determines which vector component is updated.
+ * Channel is bound to NodeComponent rather than transform field because transform storage moves
+ * with node hierarchy changes and writes must go trough NodeComponent to mark node dirty.
+ * Property path determines which vector component is updated (scalar channels) or is a bit mask
+ * of updated components (vector channels).
+ */
+template <typename V, V NodeTransform::*Property>
+struct NodeTransformProperty {
+    typedef NodeComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<NodeComponent>();
+    }
+
+    static void update(float value, size_t propertyPath, Binding node)
+    {
+        if (node != nullptr) {
+            (node->getTransform().*Property)[propertyPath] = value;
+        }
+    }
+
+    static void update(const vec4& value, size_t componentMask, Binding node)
+    {
+        if (node == nullptr) {
+            return;
+        }
+
+        auto& property = node->getTransform().*Property;
+        for (size_t i = 0; i < VectorKeyFrames::ComponentCount; ++i) {
+            if (componentMask & (1 << i)) {
+                property[i] = value[i];
+            }
+        }
+    }
+};
+
+typedef NodeTransformProperty<vec3, &NodeTransform::translation> NodeTranslationProperty;
+typedef NodeTransformProperty<vec4, &NodeTransform::rotation> NodeRotationProperty;
+typedef NodeTransformProperty<vec3, &NodeTransform::scale> NodeScaleProperty;
+
+/**
+ * @brief Map schema interpolation mode to FloatKeyFrame interpolation mode.
  */
-void updateTransformTranslation(float value, size_t propertyPath, Channel::Target target)
+FloatKeyFrame::InterpolationMode readInterpolationMode(
+    ipp::schema::resource::scene::InterpolationMode interpolationMode)
 {
-    auto& entity = target.getEntity();
-    auto node = entity.findComponent<NodeComponent>();
-    node->getTransform().translation[propertyPath] = value;
+#define MAP_KEY_FRAME_INTERPOLATION_MODE(MODE)                                                     \
+    case ipp::schema::resource::scene::InterpolationMode_##MODE:                                   \
+        return FloatKeyFrame::InterpolationMode::MODE;
+
+    switch (interpolationMode) {
+        MAP_KEY_FRAME_INTERPOLATION_MODE(Constant)
+        MAP_KEY_FRAME_INTERPOLATION_MODE(Linear)
+        MAP_KEY_FRAME_INTERPOLATION_MODE(Bezier)
+        default:
+            throw logic_error("Unknown float keyframe interpolation mode");
+    }
+#undef MAP_KEY_FRAME_INTERPOLATION_MODE
 }
 
 /**
- * @brief Applies channel update value to target Node Transform.rotation property.
- *
- * Property path determines which vector component is updated.
+ * @brief Read float key frames of Node Transform property channel.
  */
-void updateTransformRotation(float value, size_t propertyPath, Channel::Target target)
+vector<FloatKeyFrame> readNodeTransformKeyFrames(
+    const ipp::schema::resource::scene::NodeTransformChannel* channelData)
 {
-    auto& entity = target.getEntity();
-    auto node = entity.findComponent<NodeComponent>();
-    node->getTransform().rotation[propertyPath] = value;
+    vector<FloatKeyFrame> keyFrames;
+    for (auto keyFrameData : *channelData->keyFrames()) {
+        keyFrames.push_back(FloatKeyFrame(chrono::milliseconds(keyFrameData->time()),
+                                          keyFrameData->value(),
+                                          readInterpolationMode(keyFrameData->interpolationMode()),
+                                          readVec2(&keyFrameData->bezierLeft()),
+                                          readVec2(&keyFrameData->bezierRight())));
+    }
+    FloatKeyFrame::PrepareSegments(keyFrames);
+    return keyFrames;
 }
 
 /**
- * @brief Applies channel update value to target Node Transform.scale property.
- *
- * Property path determines which vector component is updated.
+ * @brief Create Channel targeting Entity Node component Transform scalar property.
  */
-void updateTransformScale(float value, size_t propertyPath, Channel::Target target)
+std::unique_ptr<Channel> createNodeTransformChannel(
+    ipp::schema::resource::scene::NodeTransformProperty property, vector<FloatKeyFrame> keyFrames)
 {
-    auto& entity = target.getEntity();
-    auto node = entity.findComponent<NodeComponent>();
-    node->getTransform().scale[propertyPath] = value;
+#define CREATE_PROPERTY_CHANNEL(PROPERTY, PROPERTY_PATH, TARGET_PROPERTY)                          \
+    case ipp::schema::resource::scene::NodeTransformProperty_##PROPERTY:                           \
+        return make_unique<KeyFrameChannel<float, FloatKeyFrame, TARGET_PROPERTY>>(PROPERTY_PATH,  \
+                                                                                   move(keyFrames));
+
+    switch (property) {
+        CREATE_PROPERTY_CHANNEL(TranslationX, 0, NodeTranslationProperty)
+        CREATE_PROPERTY_CHANNEL(TranslationY, 1, NodeTranslationProperty)
+        CREATE_PROPERTY_CHANNEL(TranslationZ, 2, NodeTranslationProperty)
+
+        CREATE_PROPERTY_CHANNEL(RotationEulerX, 0, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationEulerY, 1, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationEulerZ, 2, NodeRotationProperty)
+
+        CREATE_PROPERTY_CHANNEL(RotationQuaternionX, 0, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationQuaternionY, 1, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationQuaternionZ, 2, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationQuaternionW, 3, NodeRotationProperty)
+
+        CREATE_PROPERTY_CHANNEL(RotationAxisAngleX, 0, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationAxisAngleY, 1, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationAxisAngleZ, 2, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationAxisAngleAngle, 3, NodeRotationProperty)
+
+        CREATE_PROPERTY_CHANNEL(ScaleX, 0, NodeScaleProperty)
+        CREATE_PROPERTY_CHANNEL(ScaleY, 1, NodeScaleProperty)
+        CREATE_PROPERTY_CHANNEL(ScaleZ, 2, NodeScaleProperty)
+
+        default:
+            throw std::logic_error("Unknown animation node transform property");
+    }
+
+#undef CREATE_PROPERTY_CHANNEL
 }
 
 /**
- * @brief Read Action animation Channel targeting Entity Node component Transform property.
+ * @brief Channel evaluating fixed rate quantized vector samples for property P.
  */
-std::unique_ptr<Channel> readActionChannelNodeTransform(
-    const ipp::schema::resource::scene::NodeTransformChannel* channelData)
-{
-    vector<FloatKeyFrame> keyFrames;
-    for (auto keyFrameData : *channelData->keyFrames()) {
-        FloatKeyFrame::InterpolationMode keyFrameInterpolation;
+template <typename P>
+using SampledVectorChannel = SampledChannel<QuantizedVectorSamples, P>;
 
-#define MAP_KEY_FRAME_INTERPOLATION_MODE(MODE)                                                     \
-    case ipp::schema::resource::scene::InterpolationMode_##MODE:                                   \
-        keyFrameInterpolation = FloatKeyFrame::InterpolationMode::MODE;                            \
-        break;
+/**
+ * @brief Create Channel C targeting multiple components of Entity Node component Transform
+ *        property, channel values V are key frames or samples.
+ */
+template <template <typename> class C, typename V>
+std::unique_ptr<Channel> createNodeTransformVectorChannel(
+    ipp::schema::resource::scene::NodeTransformVectorProperty property,
+    size_t componentMask,
+    V values)
+{
+#define CREATE_PROPERTY_CHANNEL(PROPERTY, TARGET_PROPERTY)                                         \
+    case ipp::schema::resource::scene::NodeTransformVectorProperty_##PROPERTY:                     \
+        return make_unique<C<TARGET_PROPERTY>>(componentMask, move(values));
 
-        switch (keyFrameData->interpolationMode()) {
-            MAP_KEY_FRAME_INTERPOLATION_MODE(Constant)
-            MAP_KEY_FRAME_INTERPOLATION_MODE(Linear)
-            MAP_KEY_FRAME_INTERPOLATION_MODE(Bezier)
-            default:
-                throw logic_error("Unknown float keyframe interpolation mode");
-        }
-#undef MAP_KEY_FRAME_INTERPOLATION_MODE
+    switch (property) {
+        CREATE_PROPERTY_CHANNEL(Translation, NodeTranslationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationAxisAngle, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationEuler, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(RotationQuaternion, NodeRotationProperty)
+        CREATE_PROPERTY_CHANNEL(Scale, NodeScaleProperty)
 
-        keyFrames.push_back(FloatKeyFrame(chrono::milliseconds(keyFrameData->time()),
-                                          keyFrameData->value(), keyFrameInterpolation,
-                                          readVec2(&keyFrameData->bezierLeft()),
-                                          readVec2(&keyFrameData->bezierRight())));
+        default:
+            throw std::logic_error("Unknown animation node transform vector property");
     }
 
-#define CREATE_PROPERTY_CHANNEL(PROPERTY, PROPERTY_PATH, UPDATE)                                   \
+#undef CREATE_PROPERTY_CHANNEL
+}
+
+/**
+ * @brief Vector property and component index animated by a scalar Node Transform property.
+ */
+pair<ipp::schema::resource::scene::NodeTransformVectorProperty, size_t> getNodeTransformComponent(
+    ipp::schema::resource::scene::NodeTransformProperty property)
+{
+#define MAP_PROPERTY_COMPONENT(PROPERTY, VECTOR_PROPERTY, COMPONENT)                               \
     case ipp::schema::resource::scene::NodeTransformProperty_##PROPERTY:                           \
-        return make_unique<KeyFrameChannel<float, FloatKeyFrame, &UPDATE>>(PROPERTY_PATH,          \
-                                                                           keyFrames);
+        return {ipp::schema::resource::scene::NodeTransformVectorProperty_##VECTOR_PROPERTY,       \
+                COMPONENT};
 
-    switch (channelData->property()) {
-        CREATE_PROPERTY_CHANNEL(TranslationX, 0, updateTransformTranslation)
-        CREATE_PROPERTY_CHANNEL(TranslationY, 1, updateTransformTranslation)
-        CREATE_PROPERTY_CHANNEL(TranslationZ, 2, updateTransformTranslation)
+    switch (property) {
+        MAP_PROPERTY_COMPONENT(TranslationX, Translation, 0)
+        MAP_PROPERTY_COMPONENT(TranslationY, Translation, 1)
+        MAP_PROPERTY_COMPONENT(TranslationZ, Translation, 2)
 
-        CREATE_PROPERTY_CHANNEL(RotationEulerX, 0, updateTransformRotation)
-        CREATE_PROPERTY_CHANNEL(RotationEulerY, 1, updateTransformRotation)
-        CREATE_PROPERTY_CHANNEL(RotationEulerZ, 2, updateTransformRotation)
+        MAP_PROPERTY_COMPONENT(RotationEulerX, RotationEuler, 0)
+        MAP_PROPERTY_COMPONENT(RotationEulerY, RotationEuler, 1)
+        MAP_PROPERTY_COMPONENT(RotationEulerZ, RotationEuler, 2)
 
-        CREATE_PROPERTY_CHANNEL(RotationQuaternionX, 0, updateTransformRotation)
-        CREATE_PROPERTY_CHANNEL(RotationQuaternionY, 1, updateTransformRotation)
-        CREATE_PROPERTY_CHANNEL(RotationQuaternionZ, 2, updateTransformRotation)
-        CREATE_PROPERTY_CHANNEL(RotationQuaternionW, 3, updateTransformRotation)
+        MAP_PROPERTY_COMPONENT(RotationQuaternionX, RotationQuaternion, 0)
+        MAP_PROPERTY_COMPONENT(RotationQuaternionY, RotationQuaternion, 1)
+        MAP_PROPERTY_COMPONENT(RotationQuaternionZ, RotationQuaternion, 2)
+        MAP_PROPERTY_COMPONENT(RotationQuaternionW, RotationQuaternion, 3)
 
-        CREATE_PROPERTY_CHANNEL(RotationAxisAngleX, 0, updateTransformRotation)
-        CREATE_PROPERTY_CHANNEL(RotationAxisAngleY, 1, updateTransformRotation)
-        CREATE_PROPERTY_CHANNEL(RotationAxisAngleZ, 2, updateTransformRotation)
-        CREATE_PROPERTY_CHANNEL(RotationAxisAngleAngle, 3, updateTransformRotation)
+        MAP_PROPERTY_COMPONENT(RotationAxisAngleX, RotationAxisAngle, 0)
+        MAP_PROPERTY_COMPONENT(RotationAxisAngleY, RotationAxisAngle, 1)
+        MAP_PROPERTY_COMPONENT(RotationAxisAngleZ, RotationAxisAngle, 2)
+        MAP_PROPERTY_COMPONENT(RotationAxisAngleAngle, RotationAxisAngle, 3)
 
-        CREATE_PROPERTY_CHANNEL(ScaleX, 0, updateTransformScale)
-        CREATE_PROPERTY_CHANNEL(ScaleY, 1, updateTransformScale)
-        CREATE_PROPERTY_CHANNEL(ScaleZ, 2, updateTransformScale)
+        MAP_PROPERTY_COMPONENT(ScaleX, Scale, 0)
+        MAP_PROPERTY_COMPONENT(ScaleY, Scale, 1)
+        MAP_PROPERTY_COMPONENT(ScaleZ, Scale, 2)
 
         default:
             throw std::logic_error("Unknown animation node transform property");
     }
 
-#undef CREATE_PROPERTY_CHANNEL
+#undef MAP_PROPERTY_COMPONENT
+}
+
+/**
+ * @brief Key frames of scalar Node Transform property channel.
+ */
+struct NodeTransformKeyFrames {
+    ipp::schema::resource::scene::NodeTransformProperty property;
+    vector<FloatKeyFrame> keyFrames;
+};
+
+/**
+ * @brief Key of Node Transform vector property component used to track static properties.
+ */
+size_t getNodeTransformComponentKey(
+    ipp::schema::resource::scene::NodeTransformVectorProperty property, size_t component)
+{
+    return static_cast<size_t>(property) * VectorKeyFrames::ComponentCount + component;
 }
 
 /**
- * @brief Applies channel update value to target Armature SkinningPoses property.
+ * @brief Create Action animation Channels targeting Entity Node component Transform properties.
  *
- * Property path determines which Pose (bone) index is updated.
+ * Scalar channels animating components of the same vector property with matching key frame times
+ * are merged in to a single VectorKeyFrameChannel, others are created as scalar channels.
  */
-void updateBonePose(Armature::Bone::Pose value, size_t propertyPath, Channel::Target target)
+void createActionChannelsNodeTransform(vector<NodeTransformKeyFrames> transforms,
+                                       vector<unique_ptr<Channel>>& channels)
 {
-    auto& entity = target.getEntity();
-    auto armature = entity.findComponent<ArmatureComponent>();
-    armature->getBonePoses()[propertyPath] = value;
+    typedef ipp::schema::resource::scene::NodeTransformProperty ScalarProperty;
+    typedef ipp::schema::resource::scene::NodeTransformVectorProperty VectorProperty;
+
+    struct ComponentChannel {
+        ScalarProperty property;
+        size_t component;
+        vector<FloatKeyFrame> keyFrames;
+    };
+
+    constexpr size_t VectorPropertyCount = VectorProperty::NodeTransformVectorProperty_MAX + 1;
+    vector<ComponentChannel> vectorChannels[VectorPropertyCount];
+    for (auto& transform : transforms) {
+        auto vectorComponent = getNodeTransformComponent(transform.property);
+        vectorChannels[vectorComponent.first].push_back(
+            {transform.property, vectorComponent.second, move(transform.keyFrames)});
+    }
+
+    for (size_t property = 0; property < VectorPropertyCount; ++property) {
+        auto& componentChannels = vectorChannels[property];
+        const vector<FloatKeyFrame>* components[VectorKeyFrames::ComponentCount] = {};
+        size_t componentMask = 0;
+        bool duplicateComponent = false;
+        for (auto& componentChannel : componentChannels) {
+            duplicateComponent |= components[componentChannel.component] != nullptr;
+            components[componentChannel.component] = &componentChannel.keyFrames;
+            componentMask |= size_t(1) << componentChannel.component;
+        }
+
+        if (componentChannels.size() > 1 && !duplicateComponent &&
+            VectorKeyFrames::canPack(components)) {
+            auto vectorProperty = static_cast<VectorProperty>(property);
+            channels.push_back(createNodeTransformVectorChannel<VectorKeyFrameChannel>(
+                vectorProperty, componentMask, VectorKeyFrames(components)));
+            continue;
+        }
+
+        for (auto& componentChannel : componentChannels) {
+            channels.push_back(createNodeTransformChannel(componentChannel.property,
+                                                          move(componentChannel.keyFrames)));
+        }
+    }
 }
 
 /**
- * @brief Read Action animation Channel targeting Entity Armature component SkinningPoses property.
+ * @brief Read packed Action animation Channel targeting Entity Node component Transform vector.
  */
-std::unique_ptr<Channel> readActionChannelBonePose(
-    const ipp::schema::resource::scene::BonePoseChannel* channelData)
+std::unique_ptr<Channel> readActionChannelNodeTransformVector(
+    const ipp::schema::resource::scene::NodeTransformVectorChannel* channelData)
 {
+    vector<FloatKeyFrame::InterpolationMode> interpolationModes;
+    for (auto interpolationMode : *channelData->interpolationModes()) {
+        interpolationModes.push_back(readInterpolationMode(
+            static_cast<ipp::schema::resource::scene::InterpolationMode>(interpolationMode)));
+    }
+
+    return createNodeTransformVectorChannel<VectorKeyFrameChannel>(
+        channelData->property(), channelData->componentMask(),
+        VectorKeyFrames(referenceChannelData<int32_t>(channelData->times()),
+                        referenceChannelData<float>(channelData->values()), interpolationModes));
+}
+
+/**
+ * @brief Read fixed rate sampled Action animation Channel targeting Entity Node component
+ *        Transform vector.
+ */
+std::unique_ptr<Channel> readActionChannelSampledNodeTransform(
+    const ipp::schema::resource::scene::SampledNodeTransformChannel* channelData)
+{
+    return createNodeTransformVectorChannel<SampledVectorChannel>(
+        channelData->property(), channelData->componentMask(),
+        QuantizedVectorSamples(chrono::milliseconds(channelData->startTime()),
+                               channelData->sampleRate(), channelData->componentMask(),
+                               readVec4(channelData->rangeMin()),
+                               readVec4(channelData->rangeExtent()),
+                               referenceChannelData<uint16_t>(channelData->samples())));
+}
+
+/**
+ * @brief Channel property binding target Armature SkinningPoses property.
+ *
+ * Property path determines which Pose (bone) index is updated.
+ */
+struct BonePoseProperty {
+    typedef ArmatureComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<ArmatureComponent>();
+    }
+
+    static void update(Armature::Bone::Pose value, size_t propertyPath, Binding armature)
+    {
+        if (armature != nullptr) {
+            armature->getBonePoses()[propertyPath] = value;
+        }
+    }
+};
+
+/**
+ * @brief Key frames of Armature bone pose channel.
+ */
+struct BonePoseKeyFrames {
+    size_t bone;
     vector<BonePoseKeyFrame> keyFrames;
+};
+
+/**
+ * @brief Read key frames of Action animation Channel targeting Entity Armature component
+ *        SkinningPoses property.
+ */
+BonePoseKeyFrames readBonePoseKeyFrames(
+    const ipp::schema::resource::scene::BonePoseChannel* channelData)
+{
+    BonePoseKeyFrames bonePose{static_cast<size_t>(channelData->bone()), {}};
     for (auto keyFrameData : *channelData->keyFrames()) {
-        keyFrames.emplace_back(chrono::milliseconds(keyFrameData->time()),
-                               readVec3(&keyFrameData->translation()),
-                               readQuat(&keyFrameData->rotation()), keyFrameData->scale());
+        bonePose.keyFrames.emplace_back(chrono::milliseconds(keyFrameData->time()),
+                                        readVec3(&keyFrameData->translation()),
+                                        readQuat(&keyFrameData->rotation()),
+                                        keyFrameData->scale());
     }
-    return make_unique<KeyFrameChannel<Armature::Bone::Pose, BonePoseKeyFrame, &updateBonePose>>(
-        channelData->bone(), keyFrames);
+    return bonePose;
+}
+
+/**
+ * @brief Create Channel targeting Entity Armature component SkinningPoses property.
+ */
+std::unique_ptr<Channel> createBonePoseChannel(BonePoseKeyFrames bonePose)
+{
+    return make_unique<KeyFrameChannel<Armature::Bone::Pose, BonePoseKeyFrame, BonePoseProperty>>(
+        bonePose.bone, move(bonePose.keyFrames));
 }
 
 /**
- * @brief Applies channel update value to scene active camera.
+ * @brief Read fixed rate sampled Action animation Channel targeting Entity Armature component
+ *        SkinningPoses property.
  */
-void updateActiveCamera(uint32_t value, size_t propertyPath, Channel::Target target)
+std::unique_ptr<Channel> readActionChannelSampledBonePose(
+    const ipp::schema::resource::scene::SampledBonePoseChannel* channelData)
 {
-    auto& scene = target.getScene();
-    scene.getMessageLoop().enqueueCommandT<CameraNodeSystem::SetActiveCommand>(value);
+    return make_unique<SampledChannel<QuantizedPoseSamples, BonePoseProperty>>(
+        channelData->bone(),
+        QuantizedPoseSamples(chrono::milliseconds(channelData->startTime()),
+                             channelData->sampleRate(), readVec4(channelData->rangeMin()),
+                             readVec4(channelData->rangeExtent()),
+                             referenceChannelData<uint16_t>(channelData->translationScales()),
+                             referenceChannelData<uint16_t>(channelData->rotations())));
 }
 
+/**
+ * @brief Channel property binding scene active camera.
+ */
+struct ActiveCameraProperty {
+    typedef Scene* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return &target.getScene();
+    }
+
+    static void update(uint32_t value, size_t, Binding scene)
+    {
+        scene->getMessageLoop().enqueueCommandT<CameraNodeSystem::SetActiveCommand>(value);
+    }
+};
+
 /**
  * @brief
  */
@@ -240,8 +522,7 @@ unique_ptr<Channel> readActionChannelActiveCamera(
                                static_cast<uint32_t>(keyFrameData->value()));
     }
 
-    return make_unique<KeyFrameChannel<uint32_t, ConstKeyFrameT<uint32_t>, &updateActiveCamera>>(
-        0, keyFrames);
+    return make_unique<ConstKeyFrameChannel<uint32_t, ActiveCameraProperty>>(0, move(keyFrames));
 }
 
 /**
@@ -266,19 +547,48 @@ Track readAnimationTrack(Channel::Target target, const schema::resource::scene::
     return Track(trackData->name()->str(), move(strips), target);
 }
 
+/**
+ * @brief Action channels read before static channel elimination.
+ */
+struct ActionChannelsData {
+    string name;
+    size_t channelCount;
+    vector<unique_ptr<Channel>> channels;
+    vector<NodeTransformKeyFrames> transforms;
+    vector<BonePoseKeyFrames> bonePoses;
+};
+
 /**
  * @brief Read animation tracks for entity as entity sequence.
+ *
+ * Empty channels are dropped. Properties animated with the same constant value by all Actions of
+ * the sequence are folded in to sequence static channels applied when entity is bound instead of
+ * being evaluated every update. Constant channels of properties other Actions don't animate are
+ * dropped only if they match the rest transform or bind pose value entity was loaded with.
  */
 EntitySequence readAnimationEntitySequence(
     Entity& entity, const schema::resource::scene::EntitySequence* sequenceData)
 {
-    vector<Action> actions;
-    unordered_map<int, Action*> actionIdMap;
+    typedef schema::resource::scene::NodeTransformProperty ScalarProperty;
+    typedef schema::resource::scene::NodeTransformVectorProperty VectorProperty;
+
+    StaticChannelEliminator<FloatKeyFrame> staticTransforms(sequenceData->actions()->size());
+    StaticChannelEliminator<BonePoseKeyFrame> staticBonePoses(sequenceData->actions()->size());
+    auto addAnimatedTransformComponents = [&](VectorProperty property, size_t componentMask) {
+        for (size_t i = 0; i < VectorKeyFrames::ComponentCount; ++i) {
+            if (componentMask & (size_t(1) << i)) {
+                staticTransforms.addAnimated(getNodeTransformComponentKey(property, i));
+            }
+        }
+    };
+
+    vector<ActionChannelsData> actionsData;
     for (auto actionData : *sequenceData->actions()) {
         IVL_LOG(Trace, "Reading Action {} for Entity {}", entity.getName(),
                 actionData->name()->str());
 
-        vector<unique_ptr<Channel>> channels;
+        actionsData.push_back({actionData->name()->str(), actionData->channels()->size()});
+        auto& action = actionsData.back();
         for (auto channelData : *actionData->channels()) {
             std::unique_ptr<Channel> channel;
             switch (channelData->channel_type()) {
@@ -288,27 +598,144 @@ EntitySequence readAnimationEntitySequence(
                             channelData->channel()));
                     break;
 
-                case schema::resource::scene::ChannelKind_NodeTransformChannel:
-                    channel = readActionChannelNodeTransform(
+                case schema::resource::scene::ChannelKind_NodeTransformChannel: {
+                    // scalar transform channels are merged after static channels are eliminated
+                    auto transformData =
                         reinterpret_cast<const schema::resource::scene::NodeTransformChannel*>(
-                            channelData->channel()));
+                            channelData->channel());
+                    action.transforms.push_back(
+                        {transformData->property(), readNodeTransformKeyFrames(transformData)});
+                    continue;
+                }
+
+                case schema::resource::scene::ChannelKind_NodeTransformVectorChannel: {
+                    auto vectorData = reinterpret_cast<
+                        const schema::resource::scene::NodeTransformVectorChannel*>(
+                        channelData->channel());
+                    addAnimatedTransformComponents(vectorData->property(),
+                                                   vectorData->componentMask());
+                    channel = readActionChannelNodeTransformVector(vectorData);
                     break;
+                }
+
+                case schema::resource::scene::ChannelKind_SampledNodeTransformChannel: {
+                    auto sampledData = reinterpret_cast<
+                        const schema::resource::scene::SampledNodeTransformChannel*>(
+                        channelData->channel());
+                    addAnimatedTransformComponents(sampledData->property(),
+                                                   sampledData->componentMask());
+                    channel = readActionChannelSampledNodeTransform(sampledData);
+                    break;
+                }
 
                 case schema::resource::scene::ChannelKind_BonePoseChannel:
-                    channel = readActionChannelBonePose(
+                    action.bonePoses.push_back(readBonePoseKeyFrames(
                         reinterpret_cast<const schema::resource::scene::BonePoseChannel*>(
-                            channelData->channel()));
+                            channelData->channel())));
+                    continue;
+
+                case schema::resource::scene::ChannelKind_SampledBonePoseChannel: {
+                    auto sampledData =
+                        reinterpret_cast<const schema::resource::scene::SampledBonePoseChannel*>(
+                            channelData->channel());
+                    staticBonePoses.addAnimated(sampledData->bone());
+                    channel = readActionChannelSampledBonePose(sampledData);
                     break;
+                }
 
                 default:
                     IVL_LOG_THROW_ERROR(logic_error, "Invalid Entity action channel {}",
                                         static_cast<int>(channelData->channel_type()));
             }
-            channels.push_back(move(channel));
+            action.channels.push_back(move(channel));
+        }
+    }
+
+    // properties are static only if actions animate them with the same constant value
+    for (size_t actionIndex = 0; actionIndex < actionsData.size(); ++actionIndex) {
+        auto& action = actionsData[actionIndex];
+        for (auto& transform : action.transforms) {
+            auto component = getNodeTransformComponent(transform.property);
+            staticTransforms.add(actionIndex,
+                                 getNodeTransformComponentKey(component.first, component.second),
+                                 transform.keyFrames);
+        }
+        for (auto& bonePose : action.bonePoses) {
+            staticBonePoses.add(actionIndex, bonePose.bone, bonePose.keyFrames);
+        }
+    }
+
+    // rest transform and bind pose entity was loaded with, static channels aren't applied yet
+    const NodeComponent* node = entity.findComponent<NodeComponent>();
+    const ArmatureComponent* armature = entity.findComponent<ArmatureComponent>();
+    auto isRestTransform = [node](ScalarProperty property, const FloatKeyFrame& keyFrame) {
+        if (node == nullptr) {
+            return false;
+        }
+        auto& transform = node->getTransform();
+        auto component = getNodeTransformComponent(property);
+        switch (component.first) {
+            case schema::resource::scene::NodeTransformVectorProperty_Translation:
+                return transform.translation[component.second] == keyFrame.getValue();
+            case schema::resource::scene::NodeTransformVectorProperty_Scale:
+                return transform.scale[component.second] == keyFrame.getValue();
+            default:
+                return transform.rotation[component.second] == keyFrame.getValue();
+        }
+    };
+    auto isBindPose = [armature](size_t bone, const BonePoseKeyFrame& keyFrame) {
+        if (armature == nullptr || bone >= armature->getBonePoses().size()) {
+            return false;
+        }
+        auto& pose = armature->getBonePoses()[bone];
+        auto& keyFramePose = keyFrame.getPose();
+        return pose.translation == keyFramePose.translation &&
+               pose.rotation == keyFramePose.rotation && pose.scale == keyFramePose.scale;
+    };
+
+    vector<Action> actions;
+    for (auto& action : actionsData) {
+        size_t eliminatedCount = 0;
+
+        vector<NodeTransformKeyFrames> transforms;
+        for (auto& transform : action.transforms) {
+            auto component = getNodeTransformComponent(transform.property);
+            auto key = getNodeTransformComponentKey(component.first, component.second);
+            auto createChannel = [&transform]() {
+                return createNodeTransformChannel(transform.property, transform.keyFrames);
+            };
+            auto isCurrentValue = [&](const FloatKeyFrame& keyFrame) {
+                return isRestTransform(transform.property, keyFrame);
+            };
+            if (staticTransforms.eliminate(key, transform.keyFrames, createChannel,
+                                           isCurrentValue)) {
+                eliminatedCount++;
+                continue;
+            }
+            transforms.push_back(move(transform));
+        }
+        createActionChannelsNodeTransform(move(transforms), action.channels);
+
+        for (auto& bonePose : action.bonePoses) {
+            auto createChannel = [&bonePose]() { return createBonePoseChannel(bonePose); };
+            auto isCurrentValue = [&](const BonePoseKeyFrame& keyFrame) {
+                return isBindPose(bonePose.bone, keyFrame);
+            };
+            if (staticBonePoses.eliminate(bonePose.bone, bonePose.keyFrames, createChannel,
+                                          isCurrentValue)) {
+                eliminatedCount++;
+                continue;
+            }
+            action.channels.push_back(createBonePoseChannel(move(bonePose)));
+        }
+
+        if (eliminatedCount > 0) {
+            IVL_LOG(Info, "Eliminated {} of {} empty or static channels of Action {} for Entity {}",
+                    eliminatedCount, action.channelCount, action.name, entity.getName());
         }
 
         auto actionIndex = actions.size();
-        actions.emplace_back(actionIndex, actionData->name()->str(), move(channels));
+        actions.emplace_back(actionIndex, action.name, move(action.channels));
     }
 
     vector<Track> tracks;
@@ -318,7 +745,12 @@ EntitySequence readAnimationEntitySequence(
         tracks.emplace_back(readAnimationTrack(Channel::Target(entity), trackData));
     }
 
-    return EntitySequence(entity, move(actions), move(tracks));
+    // static channels move with sequence so folded values are applied again on every bind
+    auto staticChannels = staticTransforms.takeStaticChannels();
+    for (auto& channel : staticBonePoses.takeStaticChannels()) {
+        staticChannels.push_back(move(channel));
+    }
+    return EntitySequence(entity, move(actions), move(tracks), move(staticChannels));
 }
 
 SceneSequence readSceneSequence(Scene& scene,
@@ -368,6 +800,7 @@ void readAnimation(Scene& scene, const ::ipp::schema::resource::scene::Animation
     }
 
     scene.getMessageLoop().createSystem<AnimationSystem>(
-        scene, readSceneSequence(scene, animationData->sceneSequence()), move(entitySequences),
+        scene.getContext().getThreadPool(), scene,
+        readSceneSequence(scene, animationData->sceneSequence()), move(entitySequences),
         chrono::milliseconds{animationData->duration()});
 }
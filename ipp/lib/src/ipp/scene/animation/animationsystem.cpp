@@ -3,14 +3,21 @@
 #include <ipp/scene/animation/channel.hpp>
 #include <ipp/scene/animation/animationsystem.hpp>
 #include <ipp/scene/node/nodesystem.hpp>
+#include <ipp/scene/node/nodecomponent.hpp>
 #include <ipp/scene/camera/camerasystem.hpp>
+#include <ipp/scene/render/rendersystem.hpp>
+#include <ipp/scene/scene.hpp>
+#include <ipp/entity/world.hpp>
+#include <ipp/context.hpp>
 
 using namespace std;
 using namespace std::chrono;
 using namespace glm;
 using namespace ipp;
 using namespace ipp::loop;
+using namespace ipp::entity;
 using namespace ipp::scene;
+using namespace ipp::scene::node;
 using namespace ipp::scene::animation;
 
 template <>
@@ -25,6 +32,79 @@ const string AnimationSystem::StateUpdatedEvent::EventTypeName = "SceneAnimation
 template <>
 const string SystemT<AnimationSystem>::SystemTypeName = "SceneAnimationSystem";
 
+namespace {
+/**
+ * @brief Entity sequence throttling settings from "animation" configuration section.
+ */
+EvaluationScheduler::Settings getConfigurationSchedulerSettings(const json& configuration)
+{
+    EvaluationScheduler::Settings settings;
+    auto animationIt = configuration.find("animation");
+    if (animationIt == configuration.end()) {
+        return settings;
+    }
+
+    auto cullInvisibleIt = animationIt->find("cullInvisible");
+    if (cullInvisibleIt != animationIt->end() && cullInvisibleIt->is_boolean()) {
+        settings.cullInvisible = *cullInvisibleIt;
+    }
+
+    auto lodScreenSizeIt = animationIt->find("lodScreenSize");
+    if (lodScreenSizeIt != animationIt->end() && lodScreenSizeIt->is_number()) {
+        settings.lodScreenSize = *lodScreenSizeIt;
+    }
+
+    auto maxUpdateIntervalIt = animationIt->find("maxUpdateInterval");
+    if (maxUpdateIntervalIt != animationIt->end() && maxUpdateIntervalIt->is_number()) {
+        int maxUpdateInterval = *maxUpdateIntervalIt;
+        settings.maxUpdateInterval = static_cast<uint32_t>(std::max(maxUpdateInterval, 1));
+    }
+
+    auto budgetIt = animationIt->find("evaluationBudget");
+    if (budgetIt != animationIt->end() && budgetIt->is_number()) {
+        int budget = *budgetIt;
+        settings.budget = static_cast<size_t>(std::max(budget, 0));
+    }
+    return settings;
+}
+
+/**
+ * @brief Minimum interval between StateUpdatedEvents while time changes from "animation"
+ *        configuration section (0 dispatches on every time change).
+ */
+Milliseconds getConfigurationStateEventInterval(const json& configuration)
+{
+    auto animationIt = configuration.find("animation");
+    if (animationIt == configuration.end()) {
+        return Milliseconds(0);
+    }
+
+    auto intervalIt = animationIt->find("stateEventInterval");
+    if (intervalIt == animationIt->end() || !intervalIt->is_number()) {
+        return Milliseconds(0);
+    }
+
+    int interval = *intervalIt;
+    return Milliseconds(std::max(interval, 0));
+}
+}
+
+AnimationSystem::AnimationEntityObserver::AnimationEntityObserver(World& world,
+                                                                 AnimationSystem& animationSystem)
+    : WorldEntityObserver(world)
+    , _animationSystem{animationSystem}
+{
+}
+
+void AnimationSystem::AnimationEntityObserver::onEntityComponentsModified(Entity& entity)
+{
+    auto& groups = _animationSystem._entitySequenceGroups;
+    auto group = groups.find(entity);
+    if (group != groups.size()) {
+        groups.bind(group);
+    }
+}
+
 vector<SystemBase*> AnimationSystem::initialize()
 {
     registerCommandT<PlayCommand>();
@@ -32,6 +112,9 @@ vector<SystemBase*> AnimationSystem::initialize()
     registerCommandT<StopCommand>();
     registerEventT<StateUpdatedEvent>();
 
+    // render system is updated after animation, throttling uses visibility of previous frame
+    _renderSystem = getMessageLoop().findSystem<render::RenderSystem>();
+
     IVL_LOG(Trace, "Animation system initialized");
     return {};
 }
@@ -49,14 +132,24 @@ void AnimationSystem::onMessage(const Message& message)
     }
 
     if (getCommandData<StopCommand>(message)) {
+        // entity sequences skipped by throttling catch up with stop time in next update
+        _evaluateStale = _status == Status::Playing;
         _status = Status::Stopped;
-        dispatchEventT<StateUpdatedEvent>(
-            static_cast<uint32_t>(_time.count()),
-            static_cast<ipp::schema::message::animation::AnimationStatus>(_status));
+        dispatchStateUpdated();
         return;
     }
 }
 
+void AnimationSystem::dispatchStateUpdated()
+{
+    _dispatchedStateClock = steady_clock::now();
+    _dispatchedTime = _time;
+    _dispatchedStatus = _status;
+    dispatchEventT<StateUpdatedEvent>(
+        static_cast<uint32_t>(_time.count()),
+        static_cast<ipp::schema::message::animation::AnimationStatus>(_status));
+}
+
 void AnimationSystem::onPlay(Milliseconds start, Milliseconds end)
 {
     _playStart = start;
@@ -66,6 +159,9 @@ void AnimationSystem::onPlay(Milliseconds start, Milliseconds end)
             _playStart.count(), _playEnd.count(), static_cast<int>(_status));
 
     _status = Status::Playing;
+
+    // play can seek anywhere and target state could have changed while stopped
+    reset();
 }
 
 void AnimationSystem::onTimeUpdate(Milliseconds deltaTime)
@@ -80,41 +176,167 @@ void AnimationSystem::onTimeUpdate(Milliseconds deltaTime)
     }
 }
 
+void AnimationSystem::reset()
+{
+    _sceneSequence.reset();
+    _entitySequenceGroups.reset();
+    _evaluateAll = true;
+}
+
+void AnimationSystem::throttleEntitySequenceGroups()
+{
+    _scheduler.begin();
+    if (_renderSystem == nullptr) {
+        return;
+    }
+
+    // visibility that wasn't recorded in previous or current frame (RenderSystem didn't update)
+    // doesn't reflect current state, nothing is throttled
+    auto& world = _scene.getWorld();
+    auto visibilityFrame = _renderSystem->getVisibleRenderablesFrame();
+    if (visibilityFrame > world.getFrame() || visibilityFrame + 1 < world.getFrame()) {
+        return;
+    }
+
+    // only groups of entities that are rendered are throttled, groups with discrete channels can
+    // change visibility. Renderable visibility is computed from its node world matrix so groups
+    // of renderable nodes (and of armatures that are their parents) are evaluated at reduced rate
+    // when off screen rather than culled, or objects animated in to view would never appear.
+    // Poses of other armatures aren't needed when their renderables aren't visible.
+    auto throttle = [&](const Entity& entity, bool cull) {
+        auto group = _entitySequenceGroups.find(entity);
+        if (group != _entitySequenceGroups.size() && !_entitySequenceGroups.isDiscrete(group)) {
+            _scheduler.throttle(group, cull);
+        }
+    };
+    auto isParentOrSelf = [](const Node* parent, const Node* node) {
+        for (; node != nullptr; node = node->getParent()) {
+            if (node == parent) {
+                return true;
+            }
+        }
+        return false;
+    };
+    for (auto& renderableEntity : _renderSystem->getRenderableEntityGroup().getEntities()) {
+        auto renderable = get<1>(renderableEntity);
+        const NodeComponent* node = get<2>(renderableEntity);
+        throttle(renderable->getEntity(), false);
+        if (auto armature = renderable->getSkinningArmature()) {
+            const Node* armatureNode = armature->getEntity().findComponent<NodeComponent>();
+            throttle(armature->getEntity(),
+                     armatureNode == nullptr || !isParentOrSelf(armatureNode, node));
+        }
+    }
+
+    // visible renderables raise screen size of their node and armature entities and of all their
+    // parent nodes
+    auto raiseNodes = [&](const Node* node, float screenSize) {
+        for (; node != nullptr; node = node->getParent()) {
+            if (auto nodeComponent = dynamic_cast<const NodeComponent*>(node)) {
+                auto group = _entitySequenceGroups.find(nodeComponent->getEntity());
+                if (group != _entitySequenceGroups.size()) {
+                    _scheduler.raiseScreenSize(group, screenSize);
+                }
+            }
+        }
+    };
+
+    // visible renderables are resolved by entity id, entities or components removed since
+    // visibility was recorded are skipped
+    for (auto& visibility : _renderSystem->getVisibleRenderables()) {
+        auto entity = world.findEntity(visibility.entityId);
+        auto renderable = entity ? entity->findComponent<render::RenderableComponent>() : nullptr;
+        if (renderable == nullptr) {
+            continue;
+        }
+        raiseNodes(entity->findComponent<NodeComponent>(), visibility.screenSize);
+        if (auto armature = renderable->getSkinningArmature()) {
+            auto group = _entitySequenceGroups.find(armature->getEntity());
+            if (group != _entitySequenceGroups.size()) {
+                _scheduler.raiseScreenSize(group, visibility.screenSize);
+            }
+            raiseNodes(armature->getEntity().findComponent<NodeComponent>(),
+                       visibility.screenSize);
+        }
+    }
+}
+
 void AnimationSystem::onUpdate()
 {
-    // don't update animation system if animation isn't playing
-    if (_status != Status::Playing) {
+    _evaluatedSequenceCount = 0;
+
+    // don't update animation system if animation isn't playing, unless playback was just stopped
+    if (_status != Status::Playing && !_evaluateStale) {
         return;
     }
 
-    // update scene sequence
-    _sceneSequence.update(_time);
+    // sequences only need to be evaluated again when time changes (or after reset), zero delta
+    // updates and updates clamped to play end only evaluate entity sequences skipped by throttling
+    if (_evaluateAll || _time != _evaluatedTime) {
+        _sceneSequence.update(_time);
+        _evaluatedSequenceCount++;
+        _scheduler.invalidate();
+        _evaluatedTime = _time;
+    }
 
-    // update entity sequences
-    for (auto& entitySequence : _entitySequences) {
-        entitySequence.update(_time);
+    // update scheduled entity sequences, sequences of the same entity are updated in order on one
+    // thread. Time stops changing when play end is reached or playback is stopped so every entity
+    // sequence that isn't up to date is evaluated unthrottled, entities keep their final pose
+    // until next Play
+    if (_status == Status::Playing && _time != _playEnd) {
+        throttleEntitySequenceGroups();
+    } else {
+        _scheduler.begin();
+    }
+    auto& groups = _scheduler.schedule(_evaluateAll);
+    _evaluateAll = false;
+    _evaluateStale = false;
+    for (auto group : groups) {
+        _evaluatedSequenceCount += _entitySequenceGroups.getSequenceCount(group);
     }
+    _entitySequenceGroups.update(_threadPool, groups, _time);
 
     // if play end is reached update status to Completed
-    if (_time == _playEnd) {
+    if (_status == Status::Playing && _time == _playEnd) {
         _status = Status::Completed;
     }
-    dispatchEventT<StateUpdatedEvent>(
-        static_cast<uint32_t>(_time.count()),
-        static_cast<ipp::schema::message::animation::AnimationStatus>(_status));
+
+    // state event crosses to the application, status changes are dispatched immediately and time
+    // changes at most once per state event interval
+    if (_status != _dispatchedStatus ||
+        (_time != _dispatchedTime &&
+         steady_clock::now() - _dispatchedStateClock >= _stateEventInterval)) {
+        dispatchStateUpdated();
+    }
 }
 
 AnimationSystem::AnimationSystem(ipp::loop::MessageLoop& loop,
+                                 task::ThreadPool& threadPool,
                                  Scene& scene,
                                  SceneSequence&& sceneSequence,
                                  vector<EntitySequence> entitySequences,
                                  Milliseconds duration)
     : ipp::loop::SystemT<AnimationSystem>(loop)
     , _scene{scene}
+    , _threadPool{threadPool}
     , _sceneSequence{move(sceneSequence)}
-    , _entitySequences{move(entitySequences)}
+    , _entitySequenceGroups{move(entitySequences)}
+    , _scheduler{getConfigurationSchedulerSettings(scene.getContext().getConfiguration())}
+    , _renderSystem{nullptr}
+    , _evaluateAll{true}
+    , _evaluateStale{false}
     , _time(0)
     , _duration{duration}
     , _status(Status::Stopped)
+    , _evaluatedTime{0}
+    , _evaluatedSequenceCount{0}
+    , _stateEventInterval{getConfigurationStateEventInterval(scene.getContext().getConfiguration())}
+    , _dispatchedTime{0}
+    , _dispatchedStatus{Status::Stopped}
 {
+    _scheduler.resize(_entitySequenceGroups.size());
+
+    // observer binds entity sequences to existing entities when created
+    _sceneSequence.bind();
+    scene.getWorld().createEntityObserver<AnimationEntityObserver>(*this);
 }
@@ -0,0 +1,60 @@
+#include <ipp/scene/animation/entitysequencegroups.hpp>
+#include <ipp/task/parallelfor.hpp>
+
+using namespace std;
+using namespace ipp;
+using namespace ipp::entity;
+using namespace ipp::scene::animation;
+
+EntitySequenceGroups::EntitySequenceGroups(vector<EntitySequence> sequences)
+    : _sequences{move(sequences)}
+{
+    for (size_t i = 0; i < _sequences.size(); ++i) {
+        auto groupIt = _groupIndices.emplace(_sequences[i].getTarget().getId(), _groups.size());
+        if (groupIt.second) {
+            _groups.emplace_back();
+        }
+        _groups[groupIt.first->second].push_back(i);
+    }
+
+    _discrete.resize(_groups.size(), 0);
+    for (size_t group = 0; group < _groups.size(); ++group) {
+        for (auto index : _groups[group]) {
+            for (auto& action : _sequences[index].getActions()) {
+                for (auto& channel : action.getChannels()) {
+                    if (channel->isDiscrete()) {
+                        _discrete[group] = 1;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void EntitySequenceGroups::bind(size_t group)
+{
+    for (auto index : _groups[group]) {
+        _sequences[index].bind();
+    }
+}
+
+void EntitySequenceGroups::reset()
+{
+    for (auto& sequence : _sequences) {
+        sequence.reset();
+    }
+}
+
+void EntitySequenceGroups::update(task::ThreadPool& threadPool,
+                                  const vector<size_t>& groups,
+                                  Milliseconds time)
+{
+    auto updateGroups = [this, &groups, time](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            for (auto index : _groups[groups[i]]) {
+                _sequences[index].update(time);
+            }
+        }
+    };
+    task::parallelFor(threadPool, 0, groups.size(), 8, updateGroups);
+}
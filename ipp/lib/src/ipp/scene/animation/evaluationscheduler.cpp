@@ -0,0 +1,108 @@
+#include <ipp/scene/animation/evaluationscheduler.hpp>
+
+using namespace std;
+using namespace ipp::scene::animation;
+
+namespace {
+/**
+ * @brief Screen size of items that are evaluated every frame.
+ */
+constexpr float NotThrottled = -1.0f;
+}
+
+EvaluationScheduler::EvaluationScheduler(Settings settings, size_t itemCount)
+    : _settings{settings}
+    , _screenSizes(itemCount, NotThrottled)
+    , _skippedFrames(itemCount, 0)
+    , _stale(itemCount, 1)
+    , _culled(itemCount, 1)
+{
+    _settings.maxUpdateInterval = std::max<uint32_t>(_settings.maxUpdateInterval, 1);
+}
+
+void EvaluationScheduler::resize(size_t itemCount)
+{
+    _screenSizes.resize(itemCount, NotThrottled);
+    _skippedFrames.resize(itemCount, 0);
+    _stale.resize(itemCount, 1);
+    _culled.resize(itemCount, 1);
+}
+
+void EvaluationScheduler::invalidate()
+{
+    fill(_stale.begin(), _stale.end(), 1);
+}
+
+void EvaluationScheduler::begin()
+{
+    fill(_screenSizes.begin(), _screenSizes.end(), NotThrottled);
+    fill(_culled.begin(), _culled.end(), 1);
+}
+
+void EvaluationScheduler::throttle(size_t item, bool cull)
+{
+    _screenSizes[item] = std::max(_screenSizes[item], 0.0f);
+    _culled[item] &= cull ? 1 : 0;
+}
+
+uint32_t EvaluationScheduler::getUpdateInterval(float screenSize, bool culled) const
+{
+    if (screenSize <= 0) {
+        if (!_settings.cullInvisible) {
+            return 1;
+        }
+        return culled ? 0 : _settings.maxUpdateInterval;
+    }
+
+    uint32_t interval = 1;
+    while (screenSize < _settings.lodScreenSize && interval * 2 <= _settings.maxUpdateInterval) {
+        screenSize *= 2;
+        interval *= 2;
+    }
+    return interval;
+}
+
+const vector<size_t>& EvaluationScheduler::schedule(bool all)
+{
+    _scheduled.clear();
+    _throttled.clear();
+    for (size_t item = 0; item < _screenSizes.size(); ++item) {
+        if (!all && !_stale[item]) {
+            continue;
+        }
+        if (all || _screenSizes[item] < 0) {
+            _scheduled.push_back(item);
+            continue;
+        }
+
+        auto interval = getUpdateInterval(_screenSizes[item], _culled[item] != 0);
+        if (interval != 0 && _skippedFrames[item] + 1 >= interval) {
+            _throttled.push_back(item);
+        }
+    }
+
+    // over budget items that waited longest go first, larger ones first among equals
+    if (_settings.budget != 0 && _throttled.size() > _settings.budget) {
+        auto budgetEnd = _throttled.begin() + static_cast<ptrdiff_t>(_settings.budget);
+        nth_element(_throttled.begin(), budgetEnd, _throttled.end(), [this](size_t a, size_t b) {
+            if (_skippedFrames[a] != _skippedFrames[b]) {
+                return _skippedFrames[a] > _skippedFrames[b];
+            }
+            return _screenSizes[a] > _screenSizes[b];
+        });
+        _throttled.erase(budgetEnd, _throttled.end());
+    }
+
+    for (size_t item = 0; item < _skippedFrames.size(); ++item) {
+        _skippedFrames[item] += _stale[item];
+    }
+    for (auto item : _throttled) {
+        _scheduled.push_back(item);
+    }
+    sort(_scheduled.begin(), _scheduled.end());
+    for (auto item : _scheduled) {
+        _skippedFrames[item] = 0;
+        _stale[item] = 0;
+    }
+    return _scheduled;
+}
@@ -4,16 +4,172 @@ using namespace std;
 using namespace glm;
 using namespace ipp::scene::animation;
 
+namespace {
+/**
+ * @brief Evaluate c[0] * s + c[1] * s^2 + c[2] * s^3.
+ */
+template <typename T>
+T evaluateCubic(const T c[3], T s)
+{
+    return ((c[2] * s + c[1]) * s + c[0]) * s;
+}
+
+/**
+ * @brief Derivative of evaluateCubic polynomial.
+ */
+template <typename T>
+T evaluateCubicDerivative(const T c[3], T s)
+{
+    return (3 * c[2] * s + 2 * c[1]) * s + c[0];
+}
+
+/**
+ * @brief Solve evaluateCubic(c, s) = t for s in [0, 1] by bisection.
+ */
+template <typename T>
+T solveCubic(const T c[3], T t, size_t iterations)
+{
+    T low = 0;
+    T high = 1;
+    for (size_t i = 0; i < iterations; ++i) {
+        auto middle = (low + high) / 2;
+        if (evaluateCubic(c, middle) < t) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return (low + high) / 2;
+}
+
+/**
+ * @brief Coefficients of evaluateCubic for Bezier curve with p0 = 0.
+ */
+template <typename T>
+void bezierCoefficients(T p1, T p2, T p3, T c[3])
+{
+    c[0] = 3 * p1;
+    c[1] = 3 * (p2 - 2 * p1);
+    c[2] = p3 + 3 * (p1 - p2);
+}
+
+/**
+ * @brief Value error (relative to segment value range) above which Bezier segment is solved
+ *        exactly.
+ */
+constexpr double BezierValueTolerance = 1e-4;
+
+/**
+ * @brief Normalized time samples used to check Bezier segment accuracy.
+ */
+constexpr size_t BezierAccuracySamples = 64;
+}
+
+void FloatKeyFrame::PrepareSegments(vector<FloatKeyFrame>& keyFrames)
+{
+    for (size_t i = 0; i + 1 < keyFrames.size(); ++i) {
+        if (keyFrames[i]._interpolationMode == InterpolationMode::Bezier) {
+            keyFrames[i].prepareSegment(keyFrames[i + 1]);
+        }
+    }
+}
+
+void FloatKeyFrame::prepareSegment(const FloatKeyFrame& next)
+{
+    _bezierSegment = {};
+
+    double x0 = _time.count(), y0 = _value;
+    double x1 = _bezierRight.x, y1 = _bezierRight.y;
+    double x2 = next._bezierLeft.x, y2 = next._bezierLeft.y;
+    double x3 = next._time.count(), y3 = next._value;
+
+    auto length = x3 - x0;
+    if (length <= 0) {
+        return;
+    }
+
+    // scale handles overlapping in time so time curve has a single value for every time
+    // (same correction Blender applies before evaluating fcurve segment)
+    auto handlesLength = std::abs(x0 - x1) + std::abs(x3 - x2);
+    if (handlesLength > length) {
+        auto factor = length / handlesLength;
+        x1 = x0 - factor * (x0 - x1);
+        y1 = y0 - factor * (y0 - y1);
+        x2 = x3 - factor * (x3 - x2);
+        y2 = y3 - factor * (y3 - y2);
+    }
+
+    double time[3];
+    double value[3];
+    bezierCoefficients((x1 - x0) / length, (x2 - x0) / length, 1.0, time);
+    bezierCoefficients(y1 - y0, y2 - y0, y3 - y0, value);
+
+    auto& segment = _bezierSegment;
+    for (size_t i = 0; i < 3; ++i) {
+        segment.time[i] = static_cast<float>(time[i]);
+        segment.value[i] = static_cast<float>(value[i]);
+    }
+    for (size_t i = 0; i <= BezierLookupSize; ++i) {
+        auto t = static_cast<double>(i) / BezierLookupSize;
+        segment.lookup[i] = static_cast<float>(solveCubic(time, t, 48));
+    }
+
+    auto valueRange = std::max({std::abs(y1 - y0), std::abs(y2 - y0), std::abs(y3 - y0)});
+    for (size_t i = 0; i <= BezierAccuracySamples; ++i) {
+        auto t = static_cast<double>(i) / BezierAccuracySamples;
+        auto parameter = static_cast<double>(getBezierParameter(static_cast<float>(t)));
+        auto exactParameter = solveCubic(time, t, 48);
+        auto error = evaluateCubic(value, parameter) - evaluateCubic(value, exactParameter);
+        if (std::abs(error) > BezierValueTolerance * valueRange) {
+            segment.exact = true;
+            break;
+        }
+    }
+}
+
+float FloatKeyFrame::getBezierParameter(float t) const
+{
+    auto& segment = _bezierSegment;
+    if (t <= 0 || t >= 1) {
+        return t <= 0 ? 0.0f : 1.0f;
+    }
+    if (segment.exact) {
+        return solveCubic(segment.time, t, 24);
+    }
+
+    // initial guess interpolated from lookup table, Newton steps stay within table interval
+    auto position = t * BezierLookupSize;
+    auto index = std::min(static_cast<size_t>(position), BezierLookupSize - 1);
+    auto low = segment.lookup[index];
+    auto high = segment.lookup[index + 1];
+    auto s = low + (high - low) * (position - index);
+    for (size_t i = 0; i < BezierNewtonSteps; ++i) {
+        auto derivative = evaluateCubicDerivative(segment.time, s);
+        if (derivative > numeric_limits<float>::epsilon()) {
+            s -= (evaluateCubic(segment.time, s) - t) / derivative;
+        }
+        s = std::max(low, std::min(high, s));
+    }
+    return s;
+}
+
+float FloatKeyFrame::getBezierValueAt(float t) const
+{
+    return _value + evaluateCubic(_bezierSegment.value, getBezierParameter(t));
+}
+
 float FloatKeyFrame::getValueAt(const FloatKeyFrame& next, float t) const
 {
     switch (_interpolationMode) {
         case InterpolationMode::Constant:
             return _value;
         case InterpolationMode::Linear:
-        case InterpolationMode::Bezier:
-            // TODO: Actually implement bezier interpolation
             return _value * (1 - t) + next._value * t;
+        case InterpolationMode::Bezier:
+            return getBezierValueAt(t);
     }
+    return _value;
 }
 
 BonePoseKeyFrame::BonePoseKeyFrame(ipp::Milliseconds time,
@@ -0,0 +1,265 @@
+#include <ipp/scene/animation/sampledchannel.hpp>
+
+using namespace std;
+using namespace glm;
+using namespace ipp;
+using namespace ipp::render;
+using namespace ipp::scene::animation;
+
+namespace {
+/**
+ * @brief Largest 16 bit quantized value.
+ */
+constexpr float QuantizedMax = 65535.0f;
+
+/**
+ * @brief Largest 15 bit quantized value used for smallest three quaternion components.
+ */
+constexpr float RotationQuantizedMax = 32767.0f;
+
+/**
+ * @brief Range of smallest three quaternion components is [-RotationRange, RotationRange].
+ */
+const float RotationRange = 1.0f / sqrt(2.0f);
+
+uint16_t quantize(float value, float min, float extent)
+{
+    if (extent <= 0) {
+        return 0;
+    }
+    auto normalized = std::max(0.0f, std::min(1.0f, (value - min) / extent));
+    return static_cast<uint16_t>(std::round(normalized * QuantizedMax));
+}
+
+float dequantize(uint16_t value, float min, float extent)
+{
+    return min + value * (extent / QuantizedMax);
+}
+
+/**
+ * @brief Sample index and interpolation factor to next sample at time, clamped to sample range.
+ */
+void findSample(Milliseconds time,
+                Milliseconds startTime,
+                float sampleRate,
+                size_t sampleCount,
+                size_t& index,
+                float& t)
+{
+    auto position = static_cast<float>((time - startTime).count()) * sampleRate / 1000.0f;
+    index = 0;
+    t = 0;
+    if (sampleCount < 2 || position <= 0) {
+        return;
+    }
+
+    auto last = static_cast<float>(sampleCount - 1);
+    if (position >= last) {
+        index = sampleCount - 2;
+        t = 1;
+        return;
+    }
+    index = static_cast<size_t>(position);
+    t = position - static_cast<float>(index);
+}
+
+/**
+ * @brief Minimum and extent of component values.
+ */
+void computeRange(const vector<vec4>& values, vec4& rangeMin, vec4& rangeExtent)
+{
+    rangeMin = values.empty() ? vec4() : values.front();
+    auto rangeMax = rangeMin;
+    for (auto& value : values) {
+        for (int i = 0; i < 4; ++i) {
+            rangeMin[i] = std::min(rangeMin[i], value[i]);
+            rangeMax[i] = std::max(rangeMax[i], value[i]);
+        }
+    }
+    rangeExtent = rangeMax - rangeMin;
+}
+}
+
+QuantizedVectorSamples::QuantizedVectorSamples(Milliseconds startTime,
+                                               float sampleRate,
+                                               size_t componentMask,
+                                               vec4 rangeMin,
+                                               vec4 rangeExtent,
+                                               ChannelData<uint16_t> samples)
+    : _startTime{startTime}
+    , _sampleRate{sampleRate}
+    , _componentMask{componentMask}
+    , _componentCount{0}
+    , _rangeMin{rangeMin}
+    , _rangeExtent{rangeExtent}
+    , _samples{move(samples)}
+{
+    for (size_t i = 0; i < MaxComponentCount; ++i) {
+        _componentCount += (_componentMask >> i) & 1;
+    }
+    if (_componentCount == 0 || _samples.size() % _componentCount != 0) {
+        throw invalid_argument("Quantized vector sample count doesn't match component mask");
+    }
+    _sampleCount = _samples.size() / _componentCount;
+}
+
+QuantizedVectorSamples QuantizedVectorSamples::Quantize(Milliseconds startTime,
+                                                        float sampleRate,
+                                                        size_t componentMask,
+                                                        const vector<vec4>& values)
+{
+    vec4 rangeMin, rangeExtent;
+    computeRange(values, rangeMin, rangeExtent);
+
+    vector<uint16_t> samples;
+    for (auto& value : values) {
+        for (size_t i = 0; i < MaxComponentCount; ++i) {
+            if (componentMask & (size_t(1) << i)) {
+                samples.push_back(quantize(value[i], rangeMin[i], rangeExtent[i]));
+            }
+        }
+    }
+    return QuantizedVectorSamples(startTime, sampleRate, componentMask, rangeMin, rangeExtent,
+                                  move(samples));
+}
+
+vec4 QuantizedVectorSamples::getValueAt(Milliseconds time) const
+{
+    vec4 result;
+    if (_sampleCount == 0) {
+        return result;
+    }
+
+    size_t index;
+    float t;
+    findSample(time, _startTime, _sampleRate, _sampleCount, index, t);
+
+    auto sample = &_samples[index * _componentCount];
+    auto next = _sampleCount > 1 ? sample + _componentCount : sample;
+    for (size_t i = 0, component = 0; i < MaxComponentCount; ++i) {
+        if (_componentMask & (size_t(1) << i)) {
+            auto a = dequantize(sample[component], _rangeMin[i], _rangeExtent[i]);
+            auto b = dequantize(next[component], _rangeMin[i], _rangeExtent[i]);
+            result[i] = a * (1 - t) + b * t;
+            component++;
+        }
+    }
+    return result;
+}
+
+QuantizedPoseSamples::QuantizedPoseSamples(Milliseconds startTime,
+                                           float sampleRate,
+                                           vec4 rangeMin,
+                                           vec4 rangeExtent,
+                                           ChannelData<uint16_t> translationScales,
+                                           ChannelData<uint16_t> rotations)
+    : _startTime{startTime}
+    , _sampleRate{sampleRate}
+    , _sampleCount{translationScales.size() / 4}
+    , _rangeMin{rangeMin}
+    , _rangeExtent{rangeExtent}
+    , _translationScales{move(translationScales)}
+    , _rotations{move(rotations)}
+{
+    if (_translationScales.size() != _sampleCount * 4 || _rotations.size() != _sampleCount * 3) {
+        throw invalid_argument("Quantized pose translation, scale and rotation counts mismatch");
+    }
+}
+
+QuantizedPoseSamples QuantizedPoseSamples::Quantize(Milliseconds startTime,
+                                                    float sampleRate,
+                                                    const vector<Armature::Bone::Pose>& poses)
+{
+    vector<vec4> translationScaleValues;
+    for (auto& pose : poses) {
+        translationScaleValues.emplace_back(pose.translation, pose.scale);
+    }
+    vec4 rangeMin, rangeExtent;
+    computeRange(translationScaleValues, rangeMin, rangeExtent);
+
+    vector<uint16_t> translationScales;
+    vector<uint16_t> rotations(poses.size() * 3);
+    for (size_t i = 0; i < poses.size(); ++i) {
+        for (int component = 0; component < 4; ++component) {
+            translationScales.push_back(quantize(translationScaleValues[i][component],
+                                                 rangeMin[component], rangeExtent[component]));
+        }
+        QuantizeRotation(poses[i].rotation, &rotations[i * 3]);
+    }
+    return QuantizedPoseSamples(startTime, sampleRate, rangeMin, rangeExtent,
+                                move(translationScales), move(rotations));
+}
+
+void QuantizedPoseSamples::QuantizeRotation(const quat& rotation, uint16_t quantized[3])
+{
+    auto normalized = normalize(rotation);
+    float components[] = {normalized.x, normalized.y, normalized.z, normalized.w};
+
+    size_t largest = 0;
+    for (size_t i = 1; i < 4; ++i) {
+        if (std::abs(components[i]) > std::abs(components[largest])) {
+            largest = i;
+        }
+    }
+
+    // q and -q are the same rotation, flip so omitted component is positive
+    float sign = components[largest] < 0 ? -1.0f : 1.0f;
+    for (size_t i = 0, component = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        auto normalizedComponent = (sign * components[i] / RotationRange) * 0.5f + 0.5f;
+        normalizedComponent = std::max(0.0f, std::min(1.0f, normalizedComponent));
+        quantized[component++] =
+            static_cast<uint16_t>(std::round(normalizedComponent * RotationQuantizedMax));
+    }
+
+    // largest component index is stored in top bits of first two values
+    quantized[0] |= static_cast<uint16_t>((largest & 1) << 15);
+    quantized[1] |= static_cast<uint16_t>((largest >> 1) << 15);
+}
+
+quat QuantizedPoseSamples::DequantizeRotation(const uint16_t quantized[3])
+{
+    size_t largest = (quantized[0] >> 15) | ((quantized[1] >> 15) << 1);
+
+    float components[4];
+    float sum = 0;
+    for (size_t i = 0, component = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        auto value = (quantized[component++] & 0x7fff) / RotationQuantizedMax;
+        components[i] = (value * 2 - 1) * RotationRange;
+        sum += components[i] * components[i];
+    }
+    components[largest] = sqrt(std::max(0.0f, 1.0f - sum));
+
+    return quat(components[3], components[0], components[1], components[2]);
+}
+
+Armature::Bone::Pose QuantizedPoseSamples::getValueAt(Milliseconds time) const
+{
+    if (_sampleCount == 0) {
+        return {};
+    }
+
+    size_t index;
+    float t;
+    findSample(time, _startTime, _sampleRate, _sampleCount, index, t);
+    auto nextIndex = _sampleCount > 1 ? index + 1 : index;
+
+    auto translationScale = [this](size_t sample) {
+        auto quantized = &_translationScales[sample * 4];
+        vec4 value;
+        for (int i = 0; i < 4; ++i) {
+            value[i] = dequantize(quantized[i], _rangeMin[i], _rangeExtent[i]);
+        }
+        return value;
+    };
+
+    auto value = mix(translationScale(index), translationScale(nextIndex), t);
+    auto rotation = slerp(DequantizeRotation(&_rotations[index * 3]),
+                          DequantizeRotation(&_rotations[nextIndex * 3]), t);
+    return {vec3(value), rotation, value.w};
+}
@@ -0,0 +1,44 @@
+#include <ipp/scene/animation/staticchannel.hpp>
+
+using namespace std;
+using namespace ipp;
+using namespace ipp::scene::animation;
+
+bool ipp::scene::animation::isConstant(const vector<FloatKeyFrame>& keyFrames)
+{
+    auto value = keyFrames.front().getValue();
+    for (auto& keyFrame : keyFrames) {
+        if (keyFrame.getValue() != value) {
+            return false;
+        }
+        if (keyFrame.getInterpolationMode() == FloatKeyFrame::InterpolationMode::Bezier &&
+            (keyFrame.getBezierLeft().y != value || keyFrame.getBezierRight().y != value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ipp::scene::animation::isConstant(const vector<BonePoseKeyFrame>& keyFrames)
+{
+    for (auto& keyFrame : keyFrames) {
+        if (!isSameValue(keyFrame, keyFrames.front())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ipp::scene::animation::isSameValue(const FloatKeyFrame& keyFrame, const FloatKeyFrame& other)
+{
+    return keyFrame.getValue() == other.getValue();
+}
+
+bool ipp::scene::animation::isSameValue(const BonePoseKeyFrame& keyFrame,
+                                        const BonePoseKeyFrame& other)
+{
+    auto& pose = keyFrame.getPose();
+    auto& otherPose = other.getPose();
+    return pose.translation == otherPose.translation && pose.rotation == otherPose.rotation &&
+           pose.scale == otherPose.scale;
+}
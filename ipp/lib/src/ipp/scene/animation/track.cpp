@@ -25,54 +25,79 @@ Track::Track(string name, std::vector<Strip> strips, Channel::Target target)
     : _name{move(name)}
     , _strips{move(strips)}
     , _target{target}
-    , _stripLastUsed{_strips.end()}
+    , _stripLastUsed{_strips.size()}
+    , _muted{false}
 {
     // empty tracks should be filtered out by exporter and are not valid input
     assert(_strips.size() > 0);
+
+    _stripOffsets.reserve(_strips.size());
+    for (auto& strip : _strips) {
+        _stripOffsets.push_back(strip.getTrackOffset());
+    }
 }
 
 Track::Track(Track&& other)
     : _name{std::move(other._name)}
     , _strips{std::move(other._strips)}
+    , _stripOffsets{std::move(other._stripOffsets)}
     , _target{other._target}
-    , _stripLastUsed{_strips.end()}
+    , _stripLastUsed{other._stripLastUsed}
     , _muted{other._muted}
 {
 }
 
-void Track::update(const std::vector<Action>& actions, Milliseconds time)
+size_t Track::findStrip(Milliseconds time) const
 {
-    // if last used strip doesn't match time find new one that matches
-    if (_stripLastUsed == _strips.end() || time < _stripLastUsed->getTrackOffset() ||
-        time > _stripLastUsed->getTrackOffset() + _stripLastUsed->getTrackDuration()) {
-        _stripLastUsed = _strips.begin();
+    auto count = _strips.size();
+    auto isApplied = [this, count, time](size_t index) {
+        auto startsBefore = index == 0 || _stripOffsets[index] < time;
+        auto nextStartsBefore = index + 1 < count && _stripOffsets[index + 1] < time;
+        return startsBefore && !nextStartsBefore;
+    };
 
-        while (_stripLastUsed != _strips.end() && time > _stripLastUsed->getTrackOffset()) {
-            _stripLastUsed++;
-        }
+    // next strip during playback
+    if (_stripLastUsed + 1 < count && isApplied(_stripLastUsed + 1)) {
+        return _stripLastUsed + 1;
+    }
+
+    auto index = static_cast<size_t>(
+        lower_bound(_stripOffsets.begin(), _stripOffsets.end(), time) - _stripOffsets.begin());
+    return index == 0 ? 0 : index - 1;
+}
 
-        if (_stripLastUsed != _strips.begin()) {
-            _stripLastUsed--;
-        }
+void Track::update(const std::vector<Action>& actions, Milliseconds time)
+{
+    auto previousStrip = _stripLastUsed;
+
+    // if last used strip doesn't match time find new one that matches
+    if (_stripLastUsed == _strips.size() || time < _stripOffsets[_stripLastUsed] ||
+        time > _stripOffsets[_stripLastUsed] + _strips[_stripLastUsed].getTrackDuration()) {
+        _stripLastUsed = findStrip(time);
     }
+    auto& strip = _strips[_stripLastUsed];
 
     // convert from track time to strip time
-    auto stripTrackOffset = _stripLastUsed->getTrackOffset();
-    auto stripTrackDuration = _stripLastUsed->getTrackDuration();
+    auto stripTrackOffset = strip.getTrackOffset();
+    auto stripTrackDuration = strip.getTrackDuration();
     auto stripTime = std::min(time - stripTrackOffset, stripTrackDuration + Milliseconds(1));
 
     // convert stript time to action time
-    auto stripActionOffset = _stripLastUsed->getActionOffset();
-    auto stripActionDuration = _stripLastUsed->getActionDuration();
+    auto stripActionOffset = strip.getActionOffset();
+    auto stripActionDuration = strip.getActionDuration();
     auto stripTimeDurationRatio =
         static_cast<double>(stripTime.count()) / static_cast<double>(stripTrackDuration.count());
     auto actionTime =
         stripActionOffset + chrono::milliseconds(static_cast<int64_t>(stripActionDuration.count() *
                                                                       stripTimeDurationRatio));
 
-    auto& action = actions[_stripLastUsed->getActionIndex()];
-    auto actionName = action.getName();
+    auto& action = actions[strip.getActionIndex()];
+
+    // target could have been changed by previous strip action
+    if (_stripLastUsed != previousStrip) {
+        action.reset();
+    }
 
-    // apply action animation to target
-    action.updateTarget(actionTime, _target);
+    // apply action animation to bound target
+    action.updateTarget(actionTime);
 }
@@ -0,0 +1,144 @@
+#include <ipp/scene/animation/vectorchannel.hpp>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define IPP_VECTOR_CHANNEL_SSE
+#include <xmmintrin.h>
+#endif
+
+using namespace std;
+using namespace glm;
+using namespace ipp;
+using namespace ipp::scene::animation;
+
+namespace {
+/**
+ * @brief Interpolate packed components as a * (1 - t) + b * t (same expression as FloatKeyFrame).
+ */
+vec4 interpolateLinear(const float* a, const float* b, float t)
+{
+    vec4 result;
+#ifdef IPP_VECTOR_CHANNEL_SSE
+    auto weightA = _mm_set1_ps(1 - t);
+    auto weightB = _mm_set1_ps(t);
+    auto value = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a), weightA),
+                            _mm_mul_ps(_mm_loadu_ps(b), weightB));
+    _mm_storeu_ps(&result[0], value);
+#else
+    for (size_t i = 0; i < VectorKeyFrames::ComponentCount; ++i) {
+        result[i] = a[i] * (1 - t) + b[i] * t;
+    }
+#endif
+    return result;
+}
+}
+
+VectorKeyFrames::VectorKeyFrames(ChannelData<int32_t> times,
+                                 ChannelData<float> values,
+                                 const vector<FloatKeyFrame::InterpolationMode>& interpolationModes)
+    : _times{move(times)}
+    , _values{move(values)}
+    , _cursor{0}
+{
+    if (_values.size() != _times.size() * ComponentCount ||
+        interpolationModes.size() != _times.size()) {
+        throw invalid_argument("Vector key frame times, values and modes count mismatch");
+    }
+
+    _linear.reserve(interpolationModes.size());
+    for (auto mode : interpolationModes) {
+        if (mode == FloatKeyFrame::InterpolationMode::Bezier) {
+            throw invalid_argument("Vector key frames don't support Bezier interpolation");
+        }
+        _linear.push_back(mode == FloatKeyFrame::InterpolationMode::Linear);
+    }
+}
+
+VectorKeyFrames::VectorKeyFrames(const vector<FloatKeyFrame>* components[ComponentCount])
+    : _cursor{0}
+{
+    assert(canPack(components));
+
+    auto first = find_if(components, components + ComponentCount,
+                         [](auto component) { return component != nullptr; });
+    if (first == components + ComponentCount) {
+        return;
+    }
+
+    auto count = (*first)->size();
+    vector<int32_t> times;
+    vector<float> values(count * ComponentCount);
+    times.reserve(count);
+    _linear.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto& keyFrame = (**first)[i];
+        times.push_back(keyFrame.getTime().count());
+        _linear.push_back(keyFrame.getInterpolationMode() ==
+                          FloatKeyFrame::InterpolationMode::Linear);
+        for (size_t component = 0; component < ComponentCount; ++component) {
+            if (components[component] != nullptr) {
+                values[i * ComponentCount + component] = (*components[component])[i].getValue();
+            }
+        }
+    }
+    _times = move(times);
+    _values = move(values);
+}
+
+bool VectorKeyFrames::canPack(const vector<FloatKeyFrame>* components[ComponentCount])
+{
+    const vector<FloatKeyFrame>* reference = nullptr;
+    for (size_t component = 0; component < ComponentCount; ++component) {
+        auto keyFrames = components[component];
+        if (keyFrames == nullptr) {
+            continue;
+        }
+
+        for (auto& keyFrame : *keyFrames) {
+            if (keyFrame.getInterpolationMode() == FloatKeyFrame::InterpolationMode::Bezier) {
+                return false;
+            }
+        }
+
+        if (reference == nullptr) {
+            reference = keyFrames;
+            continue;
+        }
+
+        if (keyFrames->size() != reference->size()) {
+            return false;
+        }
+        for (size_t i = 0; i < keyFrames->size(); ++i) {
+            if ((*keyFrames)[i].getTime() != (*reference)[i].getTime() ||
+                (*keyFrames)[i].getInterpolationMode() != (*reference)[i].getInterpolationMode()) {
+                return false;
+            }
+        }
+    }
+    return reference != nullptr;
+}
+
+vec4 VectorKeyFrames::getValueAt(Milliseconds time)
+{
+    auto count = _times.size();
+    if (count == 0) {
+        return {};
+    }
+
+    auto index = findKeyFrameIndex(_cursor, count, time,
+                                   [this](size_t i) { return Milliseconds(_times[i]); });
+    if (index == 0 || index == count) {
+        return make_vec4(&_values[(index == 0 ? 0 : count - 1) * ComponentCount]);
+    }
+
+    auto previous = index - 1;
+    auto previousValues = &_values[previous * ComponentCount];
+    if (!_linear[previous]) {
+        return make_vec4(previousValues);
+    }
+
+    auto dt = time.count() - _times[previous];
+    auto duration = _times[index] - _times[previous];
+    auto t = static_cast<float>(dt) / static_cast<float>(duration);
+    t = std::max(0.0f, std::min(1.0f, t));
+    return interpolateLinear(previousValues, &_values[index * ComponentCount], t);
+}
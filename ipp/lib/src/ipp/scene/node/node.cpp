@@ -6,70 +6,69 @@ using namespace glm;
 using namespace ipp::resource;
 using namespace ipp::entity;
 using namespace ipp::render;
+using namespace ipp::task;
 using namespace ipp::scene::node;
 
 template <>
 const std::string ComponentT<NodeComponent>::ComponentTypeName = "SceneNodeComponent";
 
 Node::Node()
-    : _parent{nullptr}
-    , _hidden{false}
+    : _hierarchy{make_shared<NodeHierarchy>()}
 {
+    _index = _hierarchy->add(this);
 }
 
 Node::~Node()
 {
-    for (auto child : _children) {
-        child->_parent = nullptr;
-    }
-
-    if (_parent != nullptr) {
-        _parent->removeChild(this);
-    }
+    _hierarchy->release(_index);
 }
 
 void Node::updateTransform()
 {
-    _transformLocalMatrix = static_cast<mat4>(_transform);
-    if (_parent != nullptr) {
-        _transformMatrix = _parent->getTransformMatrix() * _transformParentingInverseMatrix *
-                           _transformLocalMatrix;
-    }
-    else {
-        _transformMatrix = _transformLocalMatrix;
-    }
+    _hierarchy->update();
+}
 
-    for (auto& child : _children) {
-        child->updateTransform();
-    }
+void Node::updateTransform(ThreadPool& threadPool)
+{
+    _hierarchy->update(threadPool);
 }
 
-bool Node::isHidden() const
+Node* Node::getParent()
 {
-    if (_hidden) {
-        return true;
+    auto parent = _hierarchy->_parents[_index];
+    if (parent == NodeHierarchy::NoParent) {
+        return nullptr;
     }
-    if (_parent != nullptr) {
-        return _parent->isHidden();
+    return _hierarchy->_nodes[parent];
+}
+
+const Node* Node::getParent() const
+{
+    auto parent = _hierarchy->_parents[_index];
+    if (parent == NodeHierarchy::NoParent) {
+        return nullptr;
     }
-    return false;
+    return _hierarchy->_nodes[parent];
 }
 
 void Node::addChild(Node* child, const mat4& transformParentingInverseMatrix)
 {
-    child->_parent = this;
-    child->_transformParentingInverseMatrix = transformParentingInverseMatrix;
-    _children.push_back(child);
+    if (child->_hierarchy == _hierarchy) {
+        _hierarchy->attach(child->_index, _index, transformParentingInverseMatrix);
+        return;
+    }
+
+    // keep source hierarchy alive until every node in subtree has been moved
+    auto source = child->_hierarchy;
+    source->detach(child->_index);
+    _hierarchy->attachSubtree(*source, child->_index, _index, transformParentingInverseMatrix);
 }
 
 void Node::removeChild(Node* child)
 {
-    for (auto childIt = _children.begin(); childIt != _children.end(); ++childIt) {
-        if (*childIt == child) {
-            _children.erase(childIt);
-            child->_parent = nullptr;
-            return;
-        }
+    if (child->_hierarchy != _hierarchy ||
+        _hierarchy->_parents[child->_index] != static_cast<int32_t>(_index)) {
+        throw std::range_error("Unable to find requested child node");
     }
-    throw std::range_error("Unable to find requested child node");
+    _hierarchy->detach(child->_index);
 }
@@ -0,0 +1,427 @@
+#include <ipp/scene/node/nodehierarchy.hpp>
+#include <ipp/scene/node/node.hpp>
+#include <ipp/task/parallelfor.hpp>
+#include <atomic>
+#include <mutex>
+
+using namespace std;
+using namespace glm;
+using namespace ipp::task;
+using namespace ipp::scene::node;
+
+constexpr int32_t NodeHierarchy::NoParent;
+constexpr size_t NodeHierarchy::MinWorkUnitSize;
+
+namespace {
+/**
+ * @brief Update version counter shared by all hierarchies so versions are unique across them.
+ */
+atomic<uint32_t> UpdateVersionCounter{0};
+}
+
+NodeHierarchy::NodeHierarchy()
+    : _liveCount{0}
+    , _updatedCount{0}
+    , _sorted{true}
+    , _workUnitSize{0}
+    , _updateVersion{0}
+    , _cachedMatrices{0}
+{
+}
+
+uint32_t NodeHierarchy::add(Node* node)
+{
+    auto index = static_cast<uint32_t>(_nodes.size());
+    _nodes.push_back(node);
+    _parents.push_back(NoParent);
+    _subtreeSizes.push_back(1);
+    _transforms.emplace_back();
+    _parentingInverseMatrices.emplace_back();
+    _localMatrices.emplace_back();
+    _worldMatrices.emplace_back();
+    _normalMatrices.emplace_back();
+    _inverseWorldMatrices.emplace_back();
+    _worldVersions.push_back(0);
+    _hidden.push_back(0);
+    _effectiveHidden.push_back(0);
+    _dirty.push_back(AllDirty);
+    _liveCount++;
+    return index;
+}
+
+void NodeHierarchy::release(uint32_t index)
+{
+    if (!_visibilityChangedNodes.empty()) {
+        _visibilityChangedNodes.erase(remove(_visibilityChangedNodes.begin(),
+                                             _visibilityChangedNodes.end(), _nodes[index]),
+                                      _visibilityChangedNodes.end());
+    }
+    _nodes[index] = nullptr;
+    _liveCount--;
+    _sorted = false;
+}
+
+void NodeHierarchy::attach(uint32_t index, uint32_t parent, const mat4& parentingInverseMatrix)
+{
+    for (auto ancestor = static_cast<int32_t>(parent); ancestor != NoParent;
+         ancestor = _parents[ancestor]) {
+        if (ancestor == static_cast<int32_t>(index)) {
+            throw logic_error("Node can not be attached to its own descendant");
+        }
+    }
+
+    _parents[index] = static_cast<int32_t>(parent);
+    _parentingInverseMatrices[index] = parentingInverseMatrix;
+    _dirty[index] = AllDirty;
+    _sorted = false;
+}
+
+void NodeHierarchy::detach(uint32_t index)
+{
+    if (_parents[index] != NoParent) {
+        _parents[index] = NoParent;
+        _dirty[index] = AllDirty;
+        _sorted = false;
+    }
+}
+
+void NodeHierarchy::attachSubtree(NodeHierarchy& source,
+                                  uint32_t index,
+                                  uint32_t parent,
+                                  const mat4& parentingInverseMatrix)
+{
+    if (!source._sorted) {
+        auto root = source._nodes[index];
+        source.sort();
+        index = root->_index;
+    }
+
+    auto count = source._subtreeSizes[index];
+    auto offset = static_cast<int32_t>(_nodes.size()) - static_cast<int32_t>(index);
+    for (auto sourceIndex = index; sourceIndex < index + count; ++sourceIndex) {
+        auto node = source._nodes[sourceIndex];
+        auto targetIndex = add(node);
+        if (sourceIndex == index) {
+            _parents[targetIndex] = static_cast<int32_t>(parent);
+            _parentingInverseMatrices[targetIndex] = parentingInverseMatrix;
+        }
+        else {
+            _parents[targetIndex] = source._parents[sourceIndex] + offset;
+            _parentingInverseMatrices[targetIndex] = source._parentingInverseMatrices[sourceIndex];
+        }
+        _transforms[targetIndex] = source._transforms[sourceIndex];
+        _localMatrices[targetIndex] = source._localMatrices[sourceIndex];
+        _worldMatrices[targetIndex] = source._worldMatrices[sourceIndex];
+        _normalMatrices[targetIndex] = source._normalMatrices[sourceIndex];
+        _inverseWorldMatrices[targetIndex] = source._inverseWorldMatrices[sourceIndex];
+        _hidden[targetIndex] = source._hidden[sourceIndex];
+        _effectiveHidden[targetIndex] = source._effectiveHidden[sourceIndex];
+        _dirty[targetIndex] = sourceIndex == index ? AllDirty : source._dirty[sourceIndex];
+
+        source.release(sourceIndex);
+        node->_hierarchy = _nodes[parent]->_hierarchy;
+        node->_index = targetIndex;
+    }
+    _sorted = false;
+}
+
+void NodeHierarchy::sort()
+{
+    auto slotCount = _nodes.size();
+
+    // children of released slots become roots
+    for (size_t index = 0; index < slotCount; ++index) {
+        auto parent = _parents[index];
+        if (parent != NoParent && _nodes[parent] == nullptr) {
+            _parents[index] = NoParent;
+            _dirty[index] = AllDirty;
+        }
+    }
+
+    // build child lists in slot order so sibling order is preserved
+    vector<uint32_t> childOffsets(slotCount + 1, 0);
+    for (size_t index = 0; index < slotCount; ++index) {
+        if (_nodes[index] != nullptr && _parents[index] != NoParent) {
+            childOffsets[_parents[index] + 1]++;
+        }
+    }
+    for (size_t index = 0; index < slotCount; ++index) {
+        childOffsets[index + 1] += childOffsets[index];
+    }
+    vector<uint32_t> children(childOffsets[slotCount]);
+    vector<uint32_t> childCursors(childOffsets.begin(), childOffsets.end() - 1);
+    for (size_t index = 0; index < slotCount; ++index) {
+        if (_nodes[index] != nullptr && _parents[index] != NoParent) {
+            children[childCursors[_parents[index]]++] = static_cast<uint32_t>(index);
+        }
+    }
+
+    // depth first traversal from every root
+    vector<uint32_t> order;
+    order.reserve(_liveCount);
+    vector<uint32_t> stack;
+    for (size_t root = 0; root < slotCount; ++root) {
+        if (_nodes[root] == nullptr || _parents[root] != NoParent) {
+            continue;
+        }
+        stack.push_back(static_cast<uint32_t>(root));
+        while (!stack.empty()) {
+            auto index = stack.back();
+            stack.pop_back();
+            order.push_back(index);
+            for (auto child = childOffsets[index + 1]; child > childOffsets[index]; --child) {
+                stack.push_back(children[child - 1]);
+            }
+        }
+    }
+
+    vector<int32_t> remap(slotCount, NoParent);
+    for (size_t index = 0; index < order.size(); ++index) {
+        remap[order[index]] = static_cast<int32_t>(index);
+    }
+
+    auto permute = [&order](auto& values) {
+        typename std::remove_reference<decltype(values)>::type sorted;
+        sorted.reserve(order.size());
+        for (auto index : order) {
+            sorted.push_back(values[index]);
+        }
+        values.swap(sorted);
+    };
+
+    permute(_nodes);
+    permute(_parents);
+    permute(_transforms);
+    permute(_parentingInverseMatrices);
+    permute(_localMatrices);
+    permute(_worldMatrices);
+    permute(_normalMatrices);
+    permute(_inverseWorldMatrices);
+    permute(_worldVersions);
+    permute(_hidden);
+    permute(_effectiveHidden);
+    permute(_dirty);
+
+    for (size_t index = 0; index < order.size(); ++index) {
+        _nodes[index]->_index = static_cast<uint32_t>(index);
+        if (_parents[index] != NoParent) {
+            _parents[index] = remap[_parents[index]];
+        }
+    }
+
+    // accumulate subtree sizes bottom up, children always follow their parent
+    _subtreeSizes.assign(order.size(), 1);
+    for (auto index = order.size(); index-- > 0;) {
+        if (_parents[index] != NoParent) {
+            _subtreeSizes[_parents[index]] += _subtreeSizes[index];
+        }
+    }
+
+    _sorted = true;
+    _workUnitSize = 0;
+}
+
+void NodeHierarchy::partition(size_t unitSize)
+{
+    _headSlots.clear();
+    _workUnits.clear();
+    _workUnitBatches.clear();
+
+    // descend in to subtrees larger than unitSize, their roots become head slots
+    auto count = _nodes.size();
+    for (size_t index = 0; index < count;) {
+        if (_subtreeSizes[index] > unitSize) {
+            _headSlots.push_back(static_cast<uint32_t>(index));
+            index++;
+        }
+        else {
+            _workUnits.push_back(static_cast<uint32_t>(index));
+            index += _subtreeSizes[index];
+        }
+    }
+
+    // group consecutive work units in to batches of roughly unitSize nodes
+    size_t batchSize = 0;
+    _workUnitBatches.push_back(0);
+    for (size_t unit = 0; unit < _workUnits.size(); ++unit) {
+        batchSize += _subtreeSizes[_workUnits[unit]];
+        if (batchSize >= unitSize) {
+            _workUnitBatches.push_back(unit + 1);
+            batchSize = 0;
+        }
+    }
+    if (_workUnitBatches.back() != _workUnits.size()) {
+        _workUnitBatches.push_back(_workUnits.size());
+    }
+
+    _workUnitSize = unitSize;
+}
+
+uint8_t NodeHierarchy::getInheritedDirtyFlags(int32_t parent) const
+{
+    if (parent == NoParent) {
+        return 0;
+    }
+    auto flags = _dirty[parent];
+    return ((flags & (LocalDirty | WorldDirty)) ? WorldDirty : 0) | (flags & VisibilityDirty);
+}
+
+void NodeHierarchy::updateLocalMatrices(size_t begin, size_t end)
+{
+    // compose consecutive locally dirty slots in batches
+    for (auto index = begin; index < end;) {
+        if (!(_dirty[index] & LocalDirty)) {
+            ++index;
+            continue;
+        }
+
+        auto runEnd = index + 1;
+        while (runEnd < end && (_dirty[runEnd] & LocalDirty)) {
+            ++runEnd;
+        }
+        composeTransformMatrices(&_transforms[index], runEnd - index, &_localMatrices[index]);
+        index = runEnd;
+    }
+}
+
+bool NodeHierarchy::updateSlot(size_t index, vector<Node*>& visibilityChangedNodes)
+{
+    auto flags = _dirty[index];
+    auto parent = _parents[index];
+
+    if (flags & VisibilityDirty) {
+        uint8_t hidden = _hidden[index] || (parent != NoParent && _effectiveHidden[parent]);
+        if (hidden != _effectiveHidden[index]) {
+            _effectiveHidden[index] = hidden;
+            visibilityChangedNodes.push_back(_nodes[index]);
+        }
+    }
+
+    if (!(flags & (LocalDirty | WorldDirty))) {
+        return false;
+    }
+
+    if (parent != NoParent) {
+        _worldMatrices[index] =
+            _worldMatrices[parent] * _parentingInverseMatrices[index] * _localMatrices[index];
+    }
+    else {
+        _worldMatrices[index] = _localMatrices[index];
+    }
+
+    if (_cachedMatrices & NormalMatrixCache) {
+        _normalMatrices[index] = transpose(inverse(mat3(_worldMatrices[index])));
+    }
+    if (_cachedMatrices & InverseWorldMatrixCache) {
+        _inverseWorldMatrices[index] = inverse(_worldMatrices[index]);
+    }
+    _worldVersions[index] = _updateVersion;
+    return true;
+}
+
+void NodeHierarchy::requestCachedMatrices(uint8_t cachedMatrices)
+{
+    // newly requested matrices have to be computed for every slot on next update
+    if ((_cachedMatrices | cachedMatrices) != _cachedMatrices) {
+        _cachedMatrices |= cachedMatrices;
+        for (auto& dirty : _dirty) {
+            dirty |= WorldDirty;
+        }
+    }
+}
+
+size_t NodeHierarchy::updateRange(size_t begin, size_t end, vector<Node*>& visibilityChangedNodes)
+{
+    // dirty slot flags propagate to whole subtree which follows it in slot order, flags are
+    // cleared once subtree is done so descendants can read their parent flags
+    size_t updatedCount = 0;
+    for (auto index = begin; index < end;) {
+        if (!_dirty[index]) {
+            ++index;
+            continue;
+        }
+
+        auto subtreeEnd = index + _subtreeSizes[index];
+        updateLocalMatrices(index, subtreeEnd);
+        for (auto subtreeIndex = index; subtreeIndex < subtreeEnd; ++subtreeIndex) {
+            if (subtreeIndex != index) {
+                _dirty[subtreeIndex] |= getInheritedDirtyFlags(_parents[subtreeIndex]);
+            }
+            if (updateSlot(subtreeIndex, visibilityChangedNodes)) {
+                updatedCount++;
+            }
+        }
+        fill(_dirty.begin() + index, _dirty.begin() + subtreeEnd, 0);
+        index = subtreeEnd;
+    }
+    return updatedCount;
+}
+
+void NodeHierarchy::update()
+{
+    if (!_sorted) {
+        sort();
+    }
+    _updateVersion = ++UpdateVersionCounter;
+    _visibilityChangedNodes.clear();
+    _updatedCount = updateRange(0, _nodes.size(), _visibilityChangedNodes);
+}
+
+void NodeHierarchy::update(ThreadPool& threadPool)
+{
+    if (!_sorted) {
+        sort();
+    }
+
+    _updateVersion = ++UpdateVersionCounter;
+    _visibilityChangedNodes.clear();
+    auto count = _nodes.size();
+    if (threadPool.isSerial() || count < 2 * MinWorkUnitSize) {
+        _updatedCount = updateRange(0, count, _visibilityChangedNodes);
+        return;
+    }
+
+    auto unitSize = max(MinWorkUnitSize, count / ((threadPool.getWorkerCount() + 1) * 4));
+    if (_workUnitSize != unitSize) {
+        partition(unitSize);
+    }
+
+    // head slots stay dirty until work units finish so units can read their parent flags
+    size_t headUpdatedCount = 0;
+    for (auto index : _headSlots) {
+        _dirty[index] |= getInheritedDirtyFlags(_parents[index]);
+        updateLocalMatrices(index, index + 1);
+        if (_dirty[index] && updateSlot(index, _visibilityChangedNodes)) {
+            headUpdatedCount++;
+        }
+    }
+
+    atomic<size_t> unitUpdatedCount{0};
+    mutex visibilityChangedMutex;
+    parallelFor(threadPool, 0, _workUnitBatches.size() - 1, 1, [&](size_t batchBegin,
+                                                                   size_t batchEnd) {
+        size_t updatedCount = 0;
+        vector<Node*> visibilityChangedNodes;
+        for (auto batch = batchBegin; batch < batchEnd; ++batch) {
+            for (auto unit = _workUnitBatches[batch]; unit < _workUnitBatches[batch + 1]; ++unit) {
+                auto index = _workUnits[unit];
+                _dirty[index] |= getInheritedDirtyFlags(_parents[index]);
+                updatedCount +=
+                    updateRange(index, index + _subtreeSizes[index], visibilityChangedNodes);
+            }
+        }
+        unitUpdatedCount += updatedCount;
+
+        if (!visibilityChangedNodes.empty()) {
+            lock_guard<mutex> lock(visibilityChangedMutex);
+            _visibilityChangedNodes.insert(_visibilityChangedNodes.end(),
+                                           visibilityChangedNodes.begin(),
+                                           visibilityChangedNodes.end());
+        }
+    });
+
+    for (auto index : _headSlots) {
+        _dirty[index] = 0;
+    }
+    _updatedCount = headUpdatedCount + unitUpdatedCount;
+}
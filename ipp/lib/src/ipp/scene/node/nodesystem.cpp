@@ -10,11 +10,12 @@ const std::string SystemT<NodeSystem>::SystemTypeName = "NodeSystem";
 
 void NodeSystem::onUpdate()
 {
-    // update node transforms
-    _rootNode.updateTransform();
+    // update dirty node transforms, independent subtrees are updated in parallel
+    _rootNode.updateTransform(_threadPool);
 }
 
-NodeSystem::NodeSystem(MessageLoop& messageLoop)
+NodeSystem::NodeSystem(MessageLoop& messageLoop, task::ThreadPool& threadPool)
     : SystemT<NodeSystem>(messageLoop)
+    , _threadPool{threadPool}
 {
 }
@@ -1,50 +1,129 @@
 #include <ipp/scene/node/nodetransform.hpp>
+#include <ipp/render/transformkernel.hpp>
 
 using namespace std;
 using namespace glm;
+using namespace ipp::render;
 using namespace ipp::scene::node;
 
-NodeTransform::operator mat4() const
+namespace {
+/**
+ * @brief Compose single transform matrix with closed form rotation matrix.
+ */
+void composeNodeTransformMatrix(const NodeTransform& transform, mat4& matrix)
 {
-    auto translationMatrix = glm::translate(translation);
+    auto& rotation = transform.rotation;
+    if (transform.rotationMode == NodeTransform::RotationMode::Quaternion) {
+        composeQuaternionTransformMatrix(transform.translation,
+                                         quat(rotation.w, rotation.x, rotation.y, rotation.z),
+                                         transform.scale, matrix);
+        return;
+    }
 
-    mat4 rotationMatrix;
-    if (rotationMode == RotationMode::Quaternion) {
-        rotationMatrix = toMat4(quat(rotation.w, rotation.x, rotation.y, rotation.z));
+    if (transform.rotationMode == NodeTransform::RotationMode::AxisAngle) {
+        auto axis = normalize(vec3(rotation));
+        float c = cos(rotation.w), s = sin(rotation.w), t = 1.0f - c;
+        composeTransformMatrix(
+            transform.translation,
+            vec3(t * axis.x * axis.x + c, t * axis.x * axis.y + axis.z * s,
+                 t * axis.x * axis.z - axis.y * s),
+            vec3(t * axis.x * axis.y - axis.z * s, t * axis.y * axis.y + c,
+                 t * axis.y * axis.z + axis.x * s),
+            vec3(t * axis.x * axis.z + axis.y * s, t * axis.y * axis.z - axis.x * s,
+                 t * axis.z * axis.z + c),
+            transform.scale, matrix);
+        return;
     }
-    else if (rotationMode == RotationMode::AxisAngle) {
-        auto axis = vec3(rotation);
-        rotationMatrix = axisAngleMatrix(axis, rotation.w);
+
+    float cx = cos(rotation.x), sx = sin(rotation.x);
+    float cy = cos(rotation.y), sy = sin(rotation.y);
+    float cz = cos(rotation.z), sz = sin(rotation.z);
+
+    // expanded products of X/Y/Z axis rotation matrices in order matching mode name
+    vec3 columnX, columnY, columnZ;
+    switch (transform.rotationMode) {
+        case NodeTransform::RotationMode::EulerXYZ:
+            columnX = vec3(cy * cz, cy * sz, -sy);
+            columnY = vec3(cz * sx * sy - cx * sz, sx * sy * sz + cx * cz, cy * sx);
+            columnZ = vec3(cx * cz * sy + sx * sz, cx * sy * sz - cz * sx, cx * cy);
+            break;
+        case NodeTransform::RotationMode::EulerXZY:
+            columnX = vec3(cy * cz, sz, -cz * sy);
+            columnY = vec3(sx * sy - cx * cy * sz, cx * cz, cx * sy * sz + cy * sx);
+            columnZ = vec3(cy * sx * sz + cx * sy, -cz * sx, cx * cy - sx * sy * sz);
+            break;
+        case NodeTransform::RotationMode::EulerYXZ:
+            columnX = vec3(cy * cz - sx * sy * sz, cz * sx * sy + cy * sz, -cx * sy);
+            columnY = vec3(-cx * sz, cx * cz, sx);
+            columnZ = vec3(cy * sx * sz + cz * sy, sy * sz - cy * cz * sx, cx * cy);
+            break;
+        case NodeTransform::RotationMode::EulerYZX:
+            columnX = vec3(cy * cz, cx * cy * sz + sx * sy, cy * sx * sz - cx * sy);
+            columnY = vec3(-sz, cx * cz, cz * sx);
+            columnZ = vec3(cz * sy, cx * sy * sz - cy * sx, sx * sy * sz + cx * cy);
+            break;
+        case NodeTransform::RotationMode::EulerZXY:
+            columnX = vec3(sx * sy * sz + cy * cz, cx * sz, cy * sx * sz - cz * sy);
+            columnY = vec3(cz * sx * sy - cy * sz, cx * cz, cy * cz * sx + sy * sz);
+            columnZ = vec3(cx * sy, -sx, cx * cy);
+            break;
+        case NodeTransform::RotationMode::EulerZYX:
+            columnX = vec3(cy * cz, cz * sx * sy + cx * sz, sx * sz - cx * cz * sy);
+            columnY = vec3(-cy * sz, cx * cz - sx * sy * sz, cx * sy * sz + cz * sx);
+            columnZ = vec3(sy, -cy * sx, cx * cy);
+            break;
+        default:
+            throw logic_error("Unknown node transform rotation mode");
     }
-    else {
-        auto rotationEulerX = eulerAngleX(rotation.x);
-        auto rotationEulerY = eulerAngleY(rotation.y);
-        auto rotationEulerZ = eulerAngleZ(rotation.z);
-        switch (rotationMode) {
-            case RotationMode::EulerXYZ:
-                rotationMatrix = rotationEulerZ * rotationEulerY * rotationEulerX;
-                break;
-            case RotationMode::EulerXZY:
-                rotationMatrix = rotationEulerY * rotationEulerZ * rotationEulerX;
-                break;
-            case RotationMode::EulerYXZ:
-                rotationMatrix = rotationEulerZ * rotationEulerX * rotationEulerY;
-                break;
-            case RotationMode::EulerYZX:
-                rotationMatrix = rotationEulerX * rotationEulerZ * rotationEulerY;
-                break;
-            case RotationMode::EulerZXY:
-                rotationMatrix = rotationEulerY * rotationEulerX * rotationEulerZ;
-                break;
-            case RotationMode::EulerZYX:
-                rotationMatrix = rotationEulerX * rotationEulerY * rotationEulerZ;
-                break;
-            default:
-                throw logic_error("Unknown node transform rotation mode");
+
+    composeTransformMatrix(transform.translation, columnX, columnY, columnZ, transform.scale,
+                           matrix);
+}
+
+/**
+ * @brief True if 4 transforms starting at transforms use quaternion rotation mode.
+ */
+bool isQuaternionRun(const NodeTransform* transforms)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        if (transforms[i].rotationMode != NodeTransform::RotationMode::Quaternion) {
+            return false;
         }
     }
+    return true;
+}
+}
+
+NodeTransform::operator mat4() const
+{
+    mat4 matrix;
+    composeNodeTransformMatrix(*this, matrix);
+    return matrix;
+}
 
-    auto scaleMatrix = glm::scale(scale);
+void ipp::scene::node::composeTransformMatrices(const NodeTransform* transforms,
+                                                size_t count,
+                                                mat4* matrices)
+{
+    size_t index = 0;
+    while (index < count) {
+        if (index + 4 <= count && isQuaternionRun(transforms + index)) {
+            vec3 translations[4];
+            quat rotations[4];
+            vec3 scales[4];
+            for (size_t i = 0; i < 4; ++i) {
+                auto& transform = transforms[index + i];
+                translations[i] = transform.translation;
+                rotations[i] = quat(transform.rotation.w, transform.rotation.x,
+                                    transform.rotation.y, transform.rotation.z);
+                scales[i] = transform.scale;
+            }
+            composeQuaternionTransformMatrices4(translations, rotations, scales, matrices + index);
+            index += 4;
+            continue;
+        }
 
-    return translationMatrix * rotationMatrix * scaleMatrix;
+        composeNodeTransformMatrix(transforms[index], matrices[index]);
+        index++;
+    }
 }
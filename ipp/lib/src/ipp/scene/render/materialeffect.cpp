@@ -160,10 +160,11 @@ void MaterialEffect::writeSkinningMatrices(MaterialBuffer& material,
     auto& bonePoses = armatureComponent->getBonePoses();
 
     // thread local array of matrices used to store bone parent transforms since bones are
-    // topologically sorted
-    static vector<mat4> poseMatrixCache;
-    poseMatrixCache.clear();
-    poseMatrixCache.reserve(bonePoses.size());
+    // topologically sorted, local pose matrices are composed in one batch first
+    static thread_local vector<mat4> poseMatrixCache;
+    poseMatrixCache.resize(bonePoses.size());
+    Armature::Bone::Pose::ComposeMatrices(bonePoses.data(), bonePoses.size(),
+                                          poseMatrixCache.data());
 
     // instead of using an intermediate array of vec4 for typed setter pack skinning matrices
     // directly in to material buffer memory
@@ -174,11 +175,11 @@ void MaterialEffect::writeSkinningMatrices(MaterialBuffer& material,
     for (size_t boneIndex = 0; boneIndex < boneCount; boneIndex++) {
         auto& bone = bones[boneIndex];
         auto parentIndex = bone.getParentIndex();
-        mat4 poseMatrix = static_cast<mat4>(bonePoses[boneIndex]);
+        mat4 poseMatrix = poseMatrixCache[boneIndex];
         if (parentIndex >= 0) {
             poseMatrix = poseMatrixCache[parentIndex] * poseMatrix;
         }
-        poseMatrixCache.push_back(poseMatrix);
+        poseMatrixCache[boneIndex] = poseMatrix;
 
         if (bone.isDeform()) {
             poseMatrix = poseMatrix * bone.getInverseBindPose();
@@ -18,6 +18,8 @@ RenderableComponent::RenderableComponent(Entity& entity,
     , _material{move(material)}
     , _materialBuffer{_material->getMaterialBuffer()}
     , _skinningArmature{skinningArmature}
+    , _writtenTransformVersion{0}
+    , _writtenCameraVersion{0}
 {
     auto& passes = _material->getEffect().getPasses();
     for (size_t i = 0; i < passes.size(); ++i) {
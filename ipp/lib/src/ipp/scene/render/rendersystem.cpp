@@ -3,7 +3,9 @@
 #include <ipp/scene/node/nodecomponent.hpp>
 #include <ipp/scene/camera/camerasystem.hpp>
 #include <ipp/scene/animation/animationsystem.hpp>
+#include <ipp/scene/spatial/bounds.hpp>
 #include <ipp/loop/messageloop.hpp>
+#include <ipp/task/parallelfor.hpp>
 #include <ipp/render/gl/error.hpp>
 #include <ipp/entity/world.hpp>
 
@@ -15,6 +17,7 @@ using namespace ipp::render;
 using namespace ipp::scene::render;
 using namespace ipp::scene::node;
 using namespace ipp::scene::animation;
+using namespace ipp::scene::spatial;
 
 template <>
 const string RenderSystem::ViewportResizeCommand::CommandTypeName =
@@ -36,11 +39,13 @@ vector<SystemBase*> RenderSystem::initialize()
     registerEventT<ViewportResizedEvent>();
 
     _cameraSystem = getMessageLoop().findSystem<camera::CameraSystem>();
-    auto nodeSystem = getMessageLoop().findSystem<NodeSystem>();
+    _nodeSystem = getMessageLoop().findSystem<NodeSystem>();
+    _nodeSystem->getRootNode().getHierarchy().requestCachedMatrices(
+        NodeHierarchy::NormalMatrixCache);
     auto animationSystem = getMessageLoop().findSystem<AnimationSystem>();
 
     IVL_LOG(Trace, "Render system initialized");
-    return {nodeSystem, _cameraSystem, animationSystem};
+    return {_nodeSystem, _cameraSystem, animationSystem};
 }
 
 void RenderSystem::onMessage(const Message& message)
@@ -137,6 +142,16 @@ void RenderSystem::renderParticles(const vector<tuple<float, RenderableComponent
 
 void RenderSystem::onUpdate()
 {
+    // collect renderables whose nodes changed effective visibility during node system update
+    _visibilityChangedRenderables.clear();
+    for (auto node : _nodeSystem->getVisibilityChangedNodes()) {
+        if (auto nodeComponent = dynamic_cast<NodeComponent*>(node)) {
+            if (auto renderable = nodeComponent->getEntity().findComponent<RenderableComponent>()) {
+                _visibilityChangedRenderables.push_back(renderable);
+            }
+        }
+    }
+
     // render light pass
     auto& camera = _cameraSystem->getActiveCamera();
 
@@ -147,41 +162,84 @@ void RenderSystem::onUpdate()
     vec3 cameraViewPosition = camera.getViewPosition();
     vec3 cameraViewDirection = camera.getViewPosition();
 
-    // build render queue and from world renderable node entities
-    static std::vector<std::tuple<float, RenderableComponent*>> renderQueue;
-    renderQueue.clear();
-    for (auto& renderableEntity : _renderableEntities->getEntities()) {
-        RenderableComponent* renderable = get<1>(renderableEntity);
-        NodeComponent* node = get<2>(renderableEntity);
+    // camera dependent renderable matrices only get rewritten when camera or node changes
+    if (cameraViewMatrix != _cameraViewMatrix ||
+        cameraProjectionMatrix != _cameraProjectionMatrix) {
+        _cameraViewMatrix = cameraViewMatrix;
+        _cameraProjectionMatrix = cameraProjectionMatrix;
+        _cameraVersion++;
+    }
 
-        if (node->isHidden()) {
-            continue;
-        }
+    // build render queue from world renderable node entities, per renderable material state is
+    // independent so matrix setup is split in to chunks on thread pool and queue is compacted after
+    // (frustum visibility and screen size of renderables are recorded for animation throttling)
+    auto& renderableEntities = _renderableEntities->getEntities();
+    Frustum cameraFrustum(cameraViewProjectionMatrix);
+    auto projectionScale = cameraProjectionMatrix[1][1];
+    _renderQueue.resize(renderableEntities.size());
+    _visibleRenderables.resize(renderableEntities.size());
+    task::parallelFor(_threadPool, 0, renderableEntities.size(), 64, [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            auto& renderableEntity = renderableEntities[i];
+            RenderableComponent* renderable = get<1>(renderableEntity);
+            const NodeComponent* node = get<2>(renderableEntity);
+
+            if (node->isHidden()) {
+                _renderQueue[i] = make_tuple(0.0f, nullptr);
+                _visibleRenderables[i] = {0, -1.0f};
+                continue;
+            }
 
-        const MaterialEffect& effect = renderable->getMaterial().getEffect();
-        MaterialBuffer& materialBuffer = renderable->getMaterialBuffer();
-
-        mat4 worldMatrix = node->getTransformMatrix();
-        mat3 normalMatrix = transpose(inverse(mat3(worldMatrix)));
-        mat4 worldViewMatrix = cameraViewMatrix * worldMatrix;
-        mat4 worldViewProjectionMatrix = cameraViewProjectionMatrix * worldMatrix;
-        effect.writeWorldViewProjection(materialBuffer, cameraViewPosition, cameraViewDirection,
-                                        worldMatrix, cameraViewMatrix, cameraProjectionMatrix,
-                                        cameraViewProjectionMatrix, worldViewMatrix,
-                                        worldViewProjectionMatrix, normalMatrix);
-
-        ArmatureComponent* armature = renderable->getSkinningArmature();
-        if (armature) {
-            auto name = get<0>(renderableEntity)->getName();
-            effect.writeSkinningMatrices(materialBuffer, armature);
-        }
+            const MaterialEffect& effect = renderable->getMaterial().getEffect();
+            MaterialBuffer& materialBuffer = renderable->getMaterialBuffer();
+
+            const mat4& worldMatrix = node->getTransformMatrix();
+            if (renderable->updateWrittenMatrixVersions(node->getTransformVersion(),
+                                                        _cameraVersion)) {
+                mat4 worldViewMatrix = cameraViewMatrix * worldMatrix;
+                mat4 worldViewProjectionMatrix = cameraViewProjectionMatrix * worldMatrix;
+                effect.writeWorldViewProjection(
+                    materialBuffer, cameraViewPosition, cameraViewDirection, worldMatrix,
+                    cameraViewMatrix, cameraProjectionMatrix, cameraViewProjectionMatrix,
+                    worldViewMatrix, worldViewProjectionMatrix, node->getNormalMatrix());
+            }
 
-        auto nodeEyeDistance = length2(node->getTransform().translation - cameraViewPosition);
-        renderQueue.emplace_back(nodeEyeDistance, renderable);
-    }
+            ArmatureComponent* armature = renderable->getSkinningArmature();
+            if (armature) {
+                effect.writeSkinningMatrices(materialBuffer, armature);
+            }
+
+            auto nodeEyeDistance = length2(node->getTransform().translation - cameraViewPosition);
+            _renderQueue[i] = make_tuple(nodeEyeDistance, renderable);
+
+            auto entityId = renderable->getEntity().getId();
+            _visibleRenderables[i] = {entityId, numeric_limits<float>::max()};
+            if (auto mesh = renderable->getMesh()) {
+                auto bounds =
+                    BoundingBox(mesh->getBoundsMin(), mesh->getBoundsMax()).transform(worldMatrix);
+                if (!cameraFrustum.intersects(bounds)) {
+                    _visibleRenderables[i].screenSize = -1.0f;
+                    continue;
+                }
+
+                auto radius = length(bounds.max - bounds.min) * 0.5f;
+                auto depth = -(cameraViewMatrix * vec4((bounds.min + bounds.max) * 0.5f, 1)).z;
+                _visibleRenderables[i].screenSize =
+                    radius * projectionScale / std::max(depth, radius);
+            }
+        }
+    });
+    _renderQueue.erase(remove_if(_renderQueue.begin(), _renderQueue.end(),
+                                 [](const auto& entry) { return get<1>(entry) == nullptr; }),
+                       _renderQueue.end());
+    _visibleRenderables.erase(
+        remove_if(_visibleRenderables.begin(), _visibleRenderables.end(),
+                  [](const auto& visibility) { return visibility.screenSize < 0; }),
+        _visibleRenderables.end());
+    _visibleRenderablesFrame = _world.getFrame();
 
     // sort render queue by distance from camera
-    sort(renderQueue.begin(), renderQueue.end(),
+    sort(_renderQueue.begin(), _renderQueue.end(),
          [](const auto& a, const auto& b) { return get<0>(a) < get<0>(b); });
     glViewport(0, 0, _viewportDimensions.x, _viewportDimensions.y);
     // clear default target backbuffer
@@ -203,15 +261,19 @@ void RenderSystem::onUpdate()
 
         LightComponent::Directional cameraLight{normalize(cameraViewPosition), vec3{0.8, 0.8, 0.8},
                                                 0.2f};
-        renderDirectionalLight(cameraLight, renderQueue, lightViewProjectionMatrix);
+        renderDirectionalLight(cameraLight, _renderQueue, lightViewProjectionMatrix);
     }
 
     // render particle pass
-    renderParticles(renderQueue);
+    renderParticles(_renderQueue);
 }
 
-RenderSystem::RenderSystem(MessageLoop& messageLoop, World& world)
+RenderSystem::RenderSystem(MessageLoop& messageLoop, World& world, task::ThreadPool& threadPool)
     : SystemT<RenderSystem>(messageLoop)
+    , _world{world}
+    , _threadPool{threadPool}
+    , _visibleRenderablesFrame{NoVisibilityFrame}
+    , _cameraVersion{1}
 {
     _renderableEntities = world.createEntityObserver<RenderSystem::RenderableGroup>();
     _lightEntities = world.createEntityObserver<RenderSystem::LightGroup>();
@@ -4,6 +4,7 @@
 #include <ipp/scene/camera/camerasystem.hpp>
 #include <ipp/scene/animation/animationsystem.hpp>
 #include <ipp/scene/render/rendersystem.hpp>
+#include <ipp/scene/spatial/spatialsystem.hpp>
 #include <ipp/schema/primitive_generated.h>
 #include <ipp/schema/resource/scene/animation_generated.h>
 #include <ipp/schema/resource/scene/scene_generated.h>
@@ -29,16 +30,21 @@ void readScene(Scene& scene,
 
 Scene::Scene(Context& context, std::unique_ptr<resource::ResourceBuffer> data)
     : _context{context}
-    , _resourcePath{data->getResourcePath()}
+    , _data{move(data)}
+    , _resourcePath{_data->getResourcePath()}
 {
-    auto sceneData = schema::resource::scene::GetScene(data->getData());
+    auto sceneData = schema::resource::scene::GetScene(_data->getData());
+
+    // structural World changes recorded during updates are applied at message loop sync points
+    _messageLoop.registerSyncCallback([this]() { _world.applyCommandBuffers(); });
 
     IVL_LOG(Info, "Deserializing Scene {} with {} entities", _resourcePath,
             sceneData->entities()->size());
 
     readScene(*this, context.getResourceManager(), sceneData);
     readAnimation(*this, sceneData->animation());
-    getMessageLoop().createSystem<RenderSystem>(getWorld());
+    getMessageLoop().createSystem<RenderSystem>(getWorld(), context.getThreadPool());
+    getMessageLoop().createSystem<spatial::SpatialSystem>(getWorld());
 
     IVL_LOG(Info, "Scene entities deserialization successfull");
 
@@ -49,4 +55,30 @@ Scene::Scene(Context& context, std::unique_ptr<resource::ResourceBuffer> data)
 void Scene::update()
 {
     _messageLoop.update();
+    _world.advanceFrame();
+}
+
+void Scene::captureCheckpoint(SceneCheckpoint& checkpoint) const
+{
+    checkpoint.worldSnapshot.capture(_world);
+
+    auto cameraNodeSystem = _messageLoop.findSystem<CameraNodeSystem>();
+    checkpoint.activeCameraEntityId = cameraNodeSystem->getActiveEntityId();
+}
+
+void Scene::restoreCheckpoint(const SceneCheckpoint& checkpoint)
+{
+    checkpoint.worldSnapshot.restore(_world);
+
+    // animation channels that skip unchanged values must write restored state on next update
+    if (auto animationSystem = _messageLoop.findSystem<AnimationSystem>()) {
+        animationSystem->reset();
+    }
+
+    auto cameraNodeSystem = _messageLoop.findSystem<CameraNodeSystem>();
+    if (checkpoint.activeCameraEntityId != 0 &&
+        checkpoint.activeCameraEntityId != cameraNodeSystem->getActiveEntityId()) {
+        _messageLoop.enqueueCommandT<CameraNodeSystem::SetActiveCommand>(
+            checkpoint.activeCameraEntityId);
+    }
 }
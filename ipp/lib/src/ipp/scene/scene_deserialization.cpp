@@ -1,3 +1,4 @@
+#include <ipp/context.hpp>
 #include <ipp/resource/resourcemanager.hpp>
 #include <ipp/entity/world.hpp>
 #include <ipp/render/effect.hpp>
@@ -175,7 +176,7 @@ void readScene(Scene& scene,
 {
     auto& world = scene.getWorld();
     auto& messageLoop = scene.getMessageLoop();
-    auto& nodeSystem = messageLoop.createSystem<NodeSystem>();
+    auto& nodeSystem = messageLoop.createSystem<NodeSystem>(scene.getContext().getThreadPool());
     auto& rootNode = nodeSystem.getRootNode();
 
     for (auto entityData : *sceneData->entities()) {
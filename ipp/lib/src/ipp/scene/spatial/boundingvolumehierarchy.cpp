@@ -0,0 +1,287 @@
+#include <ipp/scene/spatial/boundingvolumehierarchy.hpp>
+
+using namespace std;
+using namespace glm;
+using namespace ipp::scene::spatial;
+
+constexpr int32_t BoundingVolumeHierarchy::NullNode;
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(float margin)
+    : _root{NullNode}
+    , _freeList{NullNode}
+    , _proxyCount{0}
+    , _margin{margin}
+{
+}
+
+int32_t BoundingVolumeHierarchy::allocateNode()
+{
+    int32_t node;
+    if (_freeList == NullNode) {
+        node = static_cast<int32_t>(_nodes.size());
+        _nodes.emplace_back();
+    }
+    else {
+        node = _freeList;
+        _freeList = _nodes[node].parent;
+    }
+
+    auto& treeNode = _nodes[node];
+    treeNode.bounds = {};
+    treeNode.userId = 0;
+    treeNode.parent = NullNode;
+    treeNode.child1 = NullNode;
+    treeNode.child2 = NullNode;
+    treeNode.height = 0;
+    return node;
+}
+
+void BoundingVolumeHierarchy::freeNode(int32_t node)
+{
+    _nodes[node].parent = _freeList;
+    _nodes[node].height = -1;
+    _freeList = node;
+}
+
+int32_t BoundingVolumeHierarchy::createProxy(const BoundingBox& bounds, uint32_t userId)
+{
+    auto proxy = allocateNode();
+    _nodes[proxy].bounds = bounds.expand(_margin);
+    _nodes[proxy].userId = userId;
+    insertLeaf(proxy);
+    _proxyCount++;
+    return proxy;
+}
+
+void BoundingVolumeHierarchy::destroyProxy(int32_t proxy)
+{
+    assert(proxy >= 0 && static_cast<size_t>(proxy) < _nodes.size());
+    assert(_nodes[proxy].isLeaf() && _nodes[proxy].height == 0);
+
+    removeLeaf(proxy);
+    freeNode(proxy);
+    _proxyCount--;
+}
+
+bool BoundingVolumeHierarchy::moveProxy(int32_t proxy, const BoundingBox& bounds)
+{
+    assert(_nodes[proxy].isLeaf());
+
+    if (_nodes[proxy].bounds.contains(bounds)) {
+        return false;
+    }
+
+    removeLeaf(proxy);
+    _nodes[proxy].bounds = bounds.expand(_margin);
+    insertLeaf(proxy);
+    return true;
+}
+
+void BoundingVolumeHierarchy::insertLeaf(int32_t leaf)
+{
+    if (_root == NullNode) {
+        _root = leaf;
+        _nodes[leaf].parent = NullNode;
+        return;
+    }
+
+    // find best sibling by descending in to child with the lowest surface area cost increase
+    auto leafBounds = _nodes[leaf].bounds;
+    auto index = _root;
+    while (!_nodes[index].isLeaf()) {
+        auto& node = _nodes[index];
+        auto area = node.bounds.getSurfaceArea();
+        auto combinedArea = node.bounds.merge(leafBounds).getSurfaceArea();
+
+        // cost of creating a new parent for this node and the new leaf
+        auto cost = 2.0f * combinedArea;
+        // minimum cost of pushing the leaf further down the tree
+        auto inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int32_t child) {
+            auto& childNode = _nodes[child];
+            auto mergedArea = childNode.bounds.merge(leafBounds).getSurfaceArea();
+            if (childNode.isLeaf()) {
+                return mergedArea + inheritanceCost;
+            }
+            return mergedArea - childNode.bounds.getSurfaceArea() + inheritanceCost;
+        };
+        auto cost1 = childCost(node.child1);
+        auto cost2 = childCost(node.child2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    // create a new parent for sibling and leaf (allocation can reallocate node storage)
+    auto sibling = index;
+    auto newParent = allocateNode();
+    auto oldParent = _nodes[sibling].parent;
+    _nodes[newParent].parent = oldParent;
+    _nodes[newParent].bounds = leafBounds.merge(_nodes[sibling].bounds);
+    _nodes[newParent].height = _nodes[sibling].height + 1;
+    _nodes[newParent].child1 = sibling;
+    _nodes[newParent].child2 = leaf;
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+
+    if (oldParent != NullNode) {
+        if (_nodes[oldParent].child1 == sibling) {
+            _nodes[oldParent].child1 = newParent;
+        }
+        else {
+            _nodes[oldParent].child2 = newParent;
+        }
+    }
+    else {
+        _root = newParent;
+    }
+
+    refit(_nodes[leaf].parent);
+}
+
+void BoundingVolumeHierarchy::removeLeaf(int32_t leaf)
+{
+    if (leaf == _root) {
+        _root = NullNode;
+        return;
+    }
+
+    auto parent = _nodes[leaf].parent;
+    auto grandParent = _nodes[parent].parent;
+    auto sibling = _nodes[parent].child1 == leaf ? _nodes[parent].child2 : _nodes[parent].child1;
+
+    if (grandParent != NullNode) {
+        // replace parent with sibling
+        if (_nodes[grandParent].child1 == parent) {
+            _nodes[grandParent].child1 = sibling;
+        }
+        else {
+            _nodes[grandParent].child2 = sibling;
+        }
+        _nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        refit(grandParent);
+    }
+    else {
+        _root = sibling;
+        _nodes[sibling].parent = NullNode;
+        freeNode(parent);
+    }
+}
+
+void BoundingVolumeHierarchy::refit(int32_t index)
+{
+    while (index != NullNode) {
+        index = balance(index);
+
+        auto& node = _nodes[index];
+        auto& child1 = _nodes[node.child1];
+        auto& child2 = _nodes[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.bounds = child1.bounds.merge(child2.bounds);
+
+        index = node.parent;
+    }
+}
+
+int32_t BoundingVolumeHierarchy::balance(int32_t iA)
+{
+    auto& a = _nodes[iA];
+    if (a.isLeaf() || a.height < 2) {
+        return iA;
+    }
+
+    auto iB = a.child1;
+    auto iC = a.child2;
+    auto& b = _nodes[iB];
+    auto& c = _nodes[iC];
+
+    auto replaceInParent = [this](int32_t parent, int32_t oldChild, int32_t newChild) {
+        if (parent == NullNode) {
+            _root = newChild;
+        }
+        else if (_nodes[parent].child1 == oldChild) {
+            _nodes[parent].child1 = newChild;
+        }
+        else {
+            _nodes[parent].child2 = newChild;
+        }
+    };
+
+    auto balanceFactor = c.height - b.height;
+
+    // rotate C up
+    if (balanceFactor > 1) {
+        auto iF = c.child1;
+        auto iG = c.child2;
+        auto& f = _nodes[iF];
+        auto& g = _nodes[iG];
+
+        // swap A and C
+        c.child1 = iA;
+        c.parent = a.parent;
+        a.parent = iC;
+        replaceInParent(c.parent, iA, iC);
+
+        // keep taller of F/G under C
+        if (f.height > g.height) {
+            c.child2 = iF;
+            a.child2 = iG;
+            g.parent = iA;
+            a.bounds = b.bounds.merge(g.bounds);
+            c.bounds = a.bounds.merge(f.bounds);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        }
+        else {
+            c.child2 = iG;
+            a.child2 = iF;
+            f.parent = iA;
+            a.bounds = b.bounds.merge(f.bounds);
+            c.bounds = a.bounds.merge(g.bounds);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+        return iC;
+    }
+
+    // rotate B up
+    if (balanceFactor < -1) {
+        auto iD = b.child1;
+        auto iE = b.child2;
+        auto& d = _nodes[iD];
+        auto& e = _nodes[iE];
+
+        // swap A and B
+        b.child1 = iA;
+        b.parent = a.parent;
+        a.parent = iB;
+        replaceInParent(b.parent, iA, iB);
+
+        // keep taller of D/E under B
+        if (d.height > e.height) {
+            b.child2 = iD;
+            a.child1 = iE;
+            e.parent = iA;
+            a.bounds = c.bounds.merge(e.bounds);
+            b.bounds = a.bounds.merge(d.bounds);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        }
+        else {
+            b.child2 = iE;
+            a.child1 = iD;
+            d.parent = iA;
+            a.bounds = c.bounds.merge(d.bounds);
+            b.bounds = a.bounds.merge(e.bounds);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
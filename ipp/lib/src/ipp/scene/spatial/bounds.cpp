@@ -0,0 +1,93 @@
+#include <ipp/scene/spatial/bounds.hpp>
+
+using namespace std;
+using namespace glm;
+using namespace ipp::scene::spatial;
+
+BoundingBox BoundingBox::transform(const mat4& matrix) const
+{
+    if (isEmpty()) {
+        return {};
+    }
+
+    // transform box center and extend extents by absolute matrix (Arvo), avoids 8 corner
+    // transforms
+    auto center = (min + max) * 0.5f;
+    auto extent = (max - min) * 0.5f;
+
+    vec3 transformedCenter = vec3(matrix[3]);
+    vec3 transformedExtent{0};
+    for (int i = 0; i < 3; ++i) {
+        auto axis = vec3(matrix[i]);
+        transformedCenter += axis * center[i];
+        transformedExtent += glm::abs(axis) * extent[i];
+    }
+    return {transformedCenter - transformedExtent, transformedCenter + transformedExtent};
+}
+
+Ray Ray::FromViewport(const vec2& point, const mat4& inverseViewProjection)
+{
+    auto nearPoint = inverseViewProjection * vec4(point.x, point.y, -1, 1);
+    auto farPoint = inverseViewProjection * vec4(point.x, point.y, 1, 1);
+    auto origin = vec3(nearPoint) / nearPoint.w;
+    auto target = vec3(farPoint) / farPoint.w;
+    return {origin, normalize(target - origin)};
+}
+
+bool Ray::intersect(const BoundingBox& box, float maxDistance, float& distance) const
+{
+    float tMin = 0.0f;
+    float tMax = maxDistance;
+    for (int i = 0; i < 3; ++i) {
+        if (std::abs(direction[i]) < 1e-8f) {
+            // parallel to slab, must be inside
+            if (origin[i] < box.min[i] || origin[i] > box.max[i]) {
+                return false;
+            }
+            continue;
+        }
+
+        auto inverseDirection = 1.0f / direction[i];
+        auto t0 = (box.min[i] - origin[i]) * inverseDirection;
+        auto t1 = (box.max[i] - origin[i]) * inverseDirection;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        tMin = std::max(tMin, t0);
+        tMax = std::min(tMax, t1);
+        if (tMin > tMax) {
+            return false;
+        }
+    }
+
+    distance = tMin;
+    return true;
+}
+
+Frustum::Frustum(const mat4& viewProjection)
+{
+    // Gribb/Hartmann plane extraction from rows of view projection matrix
+    auto row = [&viewProjection](int i) {
+        return vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i],
+                    viewProjection[3][i]);
+    };
+    planes[0] = row(3) + row(0);
+    planes[1] = row(3) - row(0);
+    planes[2] = row(3) + row(1);
+    planes[3] = row(3) - row(1);
+    planes[4] = row(3) + row(2);
+    planes[5] = row(3) - row(2);
+}
+
+bool Frustum::intersects(const BoundingBox& box) const
+{
+    for (auto& plane : planes) {
+        // box corner furthest along plane normal
+        vec3 positive{plane.x >= 0 ? box.max.x : box.min.x, plane.y >= 0 ? box.max.y : box.min.y,
+                      plane.z >= 0 ? box.max.z : box.min.z};
+        if (dot(vec3(plane), positive) + plane.w < 0) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,235 @@
+#include <ipp/scene/spatial/spatialsystem.hpp>
+#include <ipp/scene/node/nodesystem.hpp>
+#include <ipp/scene/camera/camerasystem.hpp>
+#include <ipp/scene/render/rendersystem.hpp>
+#include <ipp/loop/messageloop.hpp>
+#include <ipp/entity/world.hpp>
+
+using namespace std;
+using namespace glm;
+using namespace ipp::loop;
+using namespace ipp::entity;
+using namespace ipp::scene::node;
+using namespace ipp::scene::camera;
+using namespace ipp::scene::render;
+using namespace ipp::scene::spatial;
+
+template <>
+const string SpatialSystem::PickCommand::CommandTypeName = "SceneSpatialPickCommand";
+template <>
+const string SpatialSystem::PickedEvent::EventTypeName = "SceneSpatialPickedEvent";
+template <>
+const string SpatialSystem::BoxQueryCommand::CommandTypeName = "SceneSpatialBoxQueryCommand";
+template <>
+const string SpatialSystem::BoxQueryResultEvent::EventTypeName =
+    "SceneSpatialBoxQueryResultEvent";
+template <>
+const string SystemT<SpatialSystem>::SystemTypeName = "SceneSpatialSystem";
+
+SpatialSystem::SpatialEntityObserver::SpatialEntityObserver(World& world,
+                                                            SpatialSystem& spatialSystem)
+    : WorldEntityObserver(world)
+    , _spatialSystem{spatialSystem}
+{
+}
+
+void SpatialSystem::SpatialEntityObserver::onEntityComponentsModified(Entity& entity)
+{
+    if (entity.findComponent<NodeComponent>()) {
+        _spatialSystem.updateEntity(entity);
+    }
+    else {
+        _spatialSystem.removeEntity(entity);
+    }
+}
+
+void SpatialSystem::SpatialEntityObserver::onWorldEntityRemoving(Entity& entity)
+{
+    _spatialSystem.removeEntity(entity);
+}
+
+SpatialSystem::SpatialSystem(MessageLoop& messageLoop, World& world)
+    : SystemT<SpatialSystem>(messageLoop)
+    , _cameraSystem{nullptr}
+    , _renderSystem{nullptr}
+{
+    world.createEntityObserver<SpatialEntityObserver>(*this);
+}
+
+void SpatialSystem::updateEntity(Entity& entity)
+{
+    auto entityIt = _entityIndices.find(entity.getId());
+    if (entityIt == _entityIndices.end()) {
+        auto index = _entities.size();
+        _entities.push_back({&entity, nullptr, nullptr, BoundingVolumeHierarchy::NullNode, {}, 0});
+        _entityIndices.emplace(entity.getId(), index);
+        entityIt = _entityIndices.find(entity.getId());
+    }
+
+    auto& spatialEntity = _entities[entityIt->second];
+    spatialEntity.node = entity.findComponent<NodeComponent>();
+    spatialEntity.renderable = entity.findComponent<RenderableComponent>();
+    spatialEntity.transformVersion = spatialEntity.node->getTransformVersion();
+    spatialEntity.bounds = computeBounds(spatialEntity);
+
+    if (spatialEntity.proxy == BoundingVolumeHierarchy::NullNode) {
+        spatialEntity.proxy =
+            _tree.createProxy(spatialEntity.bounds, static_cast<uint32_t>(entityIt->second));
+    }
+    else {
+        _tree.moveProxy(spatialEntity.proxy, spatialEntity.bounds);
+    }
+}
+
+void SpatialSystem::removeEntity(Entity& entity)
+{
+    auto entityIt = _entityIndices.find(entity.getId());
+    if (entityIt == _entityIndices.end()) {
+        return;
+    }
+
+    auto index = entityIt->second;
+    _tree.destroyProxy(_entities[index].proxy);
+    _entityIndices.erase(entityIt);
+
+    // swap-remove and update moved entity index and proxy user id
+    if (index + 1 != _entities.size()) {
+        _entities[index] = _entities.back();
+        _entityIndices[_entities[index].entity->getId()] = index;
+        _tree.setUserId(_entities[index].proxy, static_cast<uint32_t>(index));
+    }
+    _entities.pop_back();
+}
+
+BoundingBox SpatialSystem::computeBounds(const SpatialEntity& spatialEntity) const
+{
+    auto& transformMatrix = spatialEntity.node->getTransformMatrix();
+    if (spatialEntity.renderable != nullptr && spatialEntity.renderable->getMesh() != nullptr) {
+        auto mesh = spatialEntity.renderable->getMesh();
+        return BoundingBox(mesh->getBoundsMin(), mesh->getBoundsMax()).transform(transformMatrix);
+    }
+
+    auto position = vec3(transformMatrix[3]);
+    return {position, position};
+}
+
+vector<SystemBase*> SpatialSystem::initialize()
+{
+    registerCommandT<PickCommand>();
+    registerEventT<PickedEvent>();
+    registerCommandT<BoxQueryCommand>();
+    registerEventT<BoxQueryResultEvent>();
+
+    auto nodeSystem = getMessageLoop().findSystem<NodeSystem>();
+    _cameraSystem = getMessageLoop().findSystem<CameraSystem>();
+    _renderSystem = getMessageLoop().findSystem<RenderSystem>();
+
+    IVL_LOG(Trace, "Spatial system initialized");
+    return {nodeSystem, _cameraSystem, _renderSystem};
+}
+
+void SpatialSystem::onMessage(const Message& message)
+{
+    if (auto pickData = getCommandData<PickCommand>(message)) {
+        auto point = vec2(pickData->point().x(), pickData->point().y());
+        float distance = 0;
+        auto entityId = pick(point, distance);
+        dispatchEventT<PickedEvent>(pickData->point(), entityId, distance);
+        return;
+    }
+
+    if (auto queryData = getCommandData<BoxQueryCommand>(message)) {
+        auto& boxMin = queryData->min();
+        auto& boxMax = queryData->max();
+        BoundingBox box{{boxMin.x(), boxMin.y(), boxMin.z()}, {boxMax.x(), boxMax.y(), boxMax.z()}};
+
+        vector<uint32_t> entityIds;
+        queryBox(box, entityIds);
+
+        auto count = static_cast<uint32_t>(entityIds.size());
+        if (count == 0) {
+            dispatchEventT<BoxQueryResultEvent>(queryData->queryId(), 0u, 0u, 0u);
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            dispatchEventT<BoxQueryResultEvent>(queryData->queryId(), entityIds[i], i, count);
+        }
+        return;
+    }
+}
+
+void SpatialSystem::onUpdate()
+{
+    // node hierarchy versions absolute transforms, only nodes it changed since last update move
+    for (auto& spatialEntity : _entities) {
+        auto transformVersion = spatialEntity.node->getTransformVersion();
+        if (transformVersion == spatialEntity.transformVersion) {
+            continue;
+        }
+
+        spatialEntity.transformVersion = transformVersion;
+        spatialEntity.bounds = computeBounds(spatialEntity);
+        _tree.moveProxy(spatialEntity.proxy, spatialEntity.bounds);
+    }
+}
+
+uint32_t SpatialSystem::raycast(const Ray& ray, float maxDistance, float& distance) const
+{
+    const SpatialEntity* closest = nullptr;
+    auto closestDistance = maxDistance;
+
+    _tree.query(
+        [&](const BoundingBox& box) {
+            float boxDistance;
+            return ray.intersect(box, closestDistance, boxDistance);
+        },
+        [&](int32_t proxy) {
+            auto& spatialEntity = _entities[_tree.getUserId(proxy)];
+            float entityDistance;
+            if (ray.intersect(spatialEntity.bounds, closestDistance, entityDistance) &&
+                !spatialEntity.node->isHidden()) {
+                closest = &spatialEntity;
+                closestDistance = entityDistance;
+            }
+            return true;
+        });
+
+    if (closest == nullptr) {
+        return 0;
+    }
+    distance = closestDistance;
+    return closest->entity->getId();
+}
+
+uint32_t SpatialSystem::pick(const vec2& point, float& distance) const
+{
+    auto& camera = _cameraSystem->getActiveCamera();
+    auto& viewport = _renderSystem->getViewportDimensions();
+    auto viewProjection = camera.getProjection(viewport.x, viewport.y) * camera.getView();
+
+    auto ray = Ray::FromViewport(point, inverse(viewProjection));
+    return raycast(ray, numeric_limits<float>::max(), distance);
+}
+
+void SpatialSystem::queryBox(const BoundingBox& box, vector<uint32_t>& entityIds) const
+{
+    _tree.query([&box](const BoundingBox& nodeBox) { return box.overlaps(nodeBox); },
+                [&](int32_t proxy) {
+                    auto& spatialEntity = _entities[_tree.getUserId(proxy)];
+                    if (box.overlaps(spatialEntity.bounds)) {
+                        entityIds.push_back(spatialEntity.entity->getId());
+                    }
+                    return true;
+                });
+}
+
+void SpatialSystem::queryFrustum(const Frustum& frustum, vector<uint32_t>& entityIds) const
+{
+    _tree.query([&frustum](const BoundingBox& nodeBox) { return frustum.intersects(nodeBox); },
+                [&](int32_t proxy) {
+                    auto& spatialEntity = _entities[_tree.getUserId(proxy)];
+                    if (frustum.intersects(spatialEntity.bounds)) {
+                        entityIds.push_back(spatialEntity.entity->getId());
+                    }
+                    return true;
+                });
+}
@@ -0,0 +1,93 @@
+#include <ipp/task/taskgraph.hpp>
+#include <ipp/log.hpp>
+
+using namespace std;
+using namespace ipp::task;
+
+TaskGraph::TaskId TaskGraph::addTask(ThreadPool::Task task)
+{
+    auto node = make_unique<Node>();
+    node->task = move(task);
+    node->dependencyCount = 0;
+    node->unresolved = 0;
+    _nodes.push_back(move(node));
+    return _nodes.size() - 1;
+}
+
+void TaskGraph::addDependency(TaskId task, TaskId dependency)
+{
+    if (task >= _nodes.size() || dependency >= _nodes.size()) {
+        IVL_LOG_THROW_ERROR(out_of_range, "Invalid task graph dependency {} -> {}", dependency,
+                            task);
+    }
+    if (task == dependency) {
+        IVL_LOG_THROW_ERROR(logic_error, "Task graph task {} can't depend on itself", task);
+    }
+    _nodes[dependency]->successors.push_back(task);
+    _nodes[task]->dependencyCount++;
+}
+
+vector<TaskGraph::TaskId> TaskGraph::sortTopological() const
+{
+    vector<size_t> unresolved(_nodes.size());
+    vector<TaskId> order;
+    order.reserve(_nodes.size());
+
+    for (TaskId id = 0; id < _nodes.size(); ++id) {
+        unresolved[id] = _nodes[id]->dependencyCount;
+        if (unresolved[id] == 0) {
+            order.push_back(id);
+        }
+    }
+
+    // order doubles as a FIFO queue of resolved tasks
+    for (size_t i = 0; i < order.size(); ++i) {
+        for (auto successor : _nodes[order[i]]->successors) {
+            if (--unresolved[successor] == 0) {
+                order.push_back(successor);
+            }
+        }
+    }
+
+    if (order.size() != _nodes.size()) {
+        IVL_LOG_THROW_ERROR(logic_error, "Task graph contains a dependency cycle");
+    }
+    return order;
+}
+
+void TaskGraph::submitNode(ThreadPool& pool, TaskGroup& group, TaskId id)
+{
+    pool.submit(group, [this, &pool, &group, id]() {
+        auto& node = *_nodes[id];
+        node.task();
+        for (auto successor : node.successors) {
+            if (_nodes[successor]->unresolved.fetch_sub(1, memory_order_acq_rel) == 1) {
+                submitNode(pool, group, successor);
+            }
+        }
+    });
+}
+
+void TaskGraph::run(ThreadPool& pool)
+{
+    auto order = sortTopological();
+
+    if (pool.isSerial()) {
+        for (auto id : order) {
+            _nodes[id]->task();
+        }
+        return;
+    }
+
+    for (auto& node : _nodes) {
+        node->unresolved.store(node->dependencyCount, memory_order_relaxed);
+    }
+
+    TaskGroup group;
+    for (TaskId id = 0; id < _nodes.size(); ++id) {
+        if (_nodes[id]->dependencyCount == 0) {
+            submitNode(pool, group, id);
+        }
+    }
+    pool.wait(group);
+}
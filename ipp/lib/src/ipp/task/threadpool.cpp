@@ -0,0 +1,186 @@
+#include <ipp/task/threadpool.hpp>
+#include <ipp/log.hpp>
+
+using namespace std;
+using namespace ipp::task;
+
+namespace {
+/**
+ * @brief Pool owning current worker thread, nullptr on non-worker threads.
+ */
+thread_local ThreadPool* CurrentPool = nullptr;
+
+/**
+ * @brief Index of current worker thread in CurrentPool.
+ */
+thread_local size_t CurrentWorkerIndex = 0;
+}
+
+ThreadPool::ThreadPool(size_t workerCount)
+    : _queuedCount{0}
+    , _nextWorker{0}
+    , _stopping{false}
+{
+#ifdef __EMSCRIPTEN__
+    // no thread support, always use serial pool
+    workerCount = 0;
+#endif
+
+    for (size_t i = 0; i < workerCount; ++i) {
+        _workers.push_back(make_unique<Worker>());
+    }
+    for (size_t i = 0; i < workerCount; ++i) {
+        _workers[i]->thread = thread(&ThreadPool::workerMain, this, i);
+    }
+
+    IVL_LOG(Trace, "Created thread pool with {} worker threads", workerCount);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(_sleepMutex);
+        _stopping = true;
+    }
+    _sleepCondition.notify_all();
+
+    for (auto& worker : _workers) {
+        worker->thread.join();
+    }
+}
+
+size_t ThreadPool::GetDefaultWorkerCount()
+{
+#ifdef __EMSCRIPTEN__
+    return 0;
+#else
+    auto hardwareThreads = thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+#endif
+}
+
+void ThreadPool::execute(Entry& entry)
+{
+    try {
+        entry.task();
+    }
+    catch (...) {
+        lock_guard<mutex> lock(entry.group->_exceptionMutex);
+        if (!entry.group->_exception) {
+            entry.group->_exception = current_exception();
+        }
+    }
+    entry.group->_pending.fetch_sub(1, memory_order_acq_rel);
+}
+
+bool ThreadPool::popEntry(size_t workerIndex, Entry& entry)
+{
+    if (_queuedCount.load(memory_order_acquire) == 0) {
+        return false;
+    }
+
+    // own queue is used as a stack, most recently pushed task has the warmest data
+    {
+        auto& worker = *_workers[workerIndex];
+        lock_guard<mutex> lock(worker.mutex);
+        if (!worker.entries.empty()) {
+            entry = move(worker.entries.back());
+            worker.entries.pop_back();
+            _queuedCount.fetch_sub(1, memory_order_acq_rel);
+            return true;
+        }
+    }
+
+    // steal oldest task from other workers
+    for (size_t i = 1; i < _workers.size(); ++i) {
+        auto& victim = *_workers[(workerIndex + i) % _workers.size()];
+        lock_guard<mutex> lock(victim.mutex);
+        if (!victim.entries.empty()) {
+            entry = move(victim.entries.front());
+            victim.entries.pop_front();
+            _queuedCount.fetch_sub(1, memory_order_acq_rel);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::workerMain(size_t workerIndex)
+{
+    CurrentPool = this;
+    CurrentWorkerIndex = workerIndex;
+
+    Entry entry;
+    while (true) {
+        if (popEntry(workerIndex, entry)) {
+            execute(entry);
+            continue;
+        }
+
+        unique_lock<mutex> lock(_sleepMutex);
+        _sleepCondition.wait(lock, [this]() {
+            return _stopping || _queuedCount.load(memory_order_acquire) > 0;
+        });
+        if (_stopping) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::submit(TaskGroup& group, Task task)
+{
+    group._pending.fetch_add(1, memory_order_acq_rel);
+
+    if (isSerial()) {
+        Entry entry{move(task), &group};
+        execute(entry);
+        return;
+    }
+
+    auto workerIndex = CurrentPool == this
+                           ? CurrentWorkerIndex
+                           : _nextWorker.fetch_add(1, memory_order_relaxed) % _workers.size();
+    {
+        auto& worker = *_workers[workerIndex];
+        lock_guard<mutex> lock(worker.mutex);
+        worker.entries.push_back(Entry{move(task), &group});
+    }
+    _queuedCount.fetch_add(1, memory_order_acq_rel);
+
+    // acquire sleep mutex so a worker can't miss the wakeup between predicate check and wait
+    {
+        lock_guard<mutex> lock(_sleepMutex);
+    }
+    _sleepCondition.notify_one();
+}
+
+bool ThreadPool::runPendingTask()
+{
+    if (isSerial()) {
+        return false;
+    }
+
+    Entry entry;
+    auto workerIndex = CurrentPool == this ? CurrentWorkerIndex : 0;
+    if (!popEntry(workerIndex, entry)) {
+        return false;
+    }
+    execute(entry);
+    return true;
+}
+
+void ThreadPool::wait(TaskGroup& group)
+{
+    while (!group.isComplete()) {
+        if (!runPendingTask()) {
+            this_thread::yield();
+        }
+    }
+
+    if (group._exception) {
+        auto exception = group._exception;
+        group._exception = nullptr;
+        rethrow_exception(exception);
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <chrono>
+
+/**
+ * @brief Run function repeat times and return average duration in microseconds.
+ */
+template <typename Function>
+double measureMicroseconds(size_t repeat, Function function)
+{
+    using namespace std::chrono;
+    auto start = high_resolution_clock::now();
+    for (size_t i = 0; i < repeat; ++i) {
+        function();
+    }
+    auto end = high_resolution_clock::now();
+    return duration_cast<duration<double, std::micro>>(end - start).count() / repeat;
+}
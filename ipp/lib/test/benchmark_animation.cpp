@@ -0,0 +1,233 @@
+#include <catch.hpp>
+#include <random>
+#include <ipp/log.hpp>
+#include <ipp/entity/world.hpp>
+#include <ipp/scene/animation/keyframe.hpp>
+#include <ipp/scene/animation/sampledchannel.hpp>
+#include <ipp/scene/animation/track.hpp>
+#include "benchmark.hpp"
+
+using namespace std;
+using namespace glm;
+using namespace ipp;
+using namespace ipp::entity;
+using namespace ipp::scene::animation;
+
+namespace {
+/**
+ * @brief Bezier segment value solving curve parameter with Newton iteration on every sample.
+ */
+float evaluateBezierNewton(vec2 p0, vec2 p1, vec2 p2, vec2 p3, float time)
+{
+    auto length = p3.x - p0.x;
+    auto handlesLength = std::abs(p0.x - p1.x) + std::abs(p3.x - p2.x);
+    if (handlesLength > length) {
+        auto factor = length / handlesLength;
+        p1 = p0 - factor * (p0 - p1);
+        p2 = p3 - factor * (p3 - p2);
+    }
+
+    auto evaluate = [](float a, float b, float c, float d, float s) {
+        auto r = 1 - s;
+        return r * r * r * a + 3 * r * r * s * b + 3 * r * s * s * c + s * s * s * d;
+    };
+    auto derivative = [](float a, float b, float c, float d, float s) {
+        auto r = 1 - s;
+        return 3 * r * r * (b - a) + 6 * r * s * (c - b) + 3 * s * s * (d - c);
+    };
+
+    auto s = (time - p0.x) / length;
+    for (int i = 0; i < 16; ++i) {
+        auto error = evaluate(p0.x, p1.x, p2.x, p3.x, s) - time;
+        if (std::abs(error) < 1e-4f * length) {
+            break;
+        }
+        auto slope = derivative(p0.x, p1.x, p2.x, p3.x, s);
+        if (slope <= 0) {
+            break;
+        }
+        s = std::max(0.0f, std::min(1.0f, s - error / slope));
+    }
+    return evaluate(p0.y, p1.y, p2.y, p3.y, s);
+}
+
+/**
+ * @brief Channel that only records last update time.
+ */
+class TimeChannel final : public Channel {
+public:
+    Milliseconds time;
+
+    void bind(Channel::Target) override
+    {
+    }
+
+    void updateTarget(Milliseconds updateTime) override
+    {
+        time = updateTime;
+    }
+};
+
+/**
+ * @brief Strip index found by walking strips from first one (Track lookup before strip index).
+ */
+size_t findStripLinear(const vector<Track::Strip>& strips, Milliseconds time)
+{
+    size_t index = 0;
+    while (index < strips.size() && time > strips[index].getTrackOffset()) {
+        index++;
+    }
+    return index == 0 ? 0 : index - 1;
+}
+}
+
+SCENARIO("Bezier key frame evaluation benchmark", "[.][benchmark]")
+{
+    const size_t segmentCount = 1000;
+    const size_t sampleCount = 100;
+
+    mt19937 random(1);
+    uniform_real_distribution<float> handle(0.15f, 0.5f);
+    uniform_real_distribution<float> value(-5.0f, 5.0f);
+
+    vector<FloatKeyFrame> keyFrames;
+    for (size_t i = 0; i <= segmentCount; ++i) {
+        auto time = static_cast<float>(i * 100);
+        keyFrames.emplace_back(Milliseconds(i * 100), value(random),
+                               FloatKeyFrame::InterpolationMode::Bezier,
+                               vec2(time - handle(random) * 100, value(random)),
+                               vec2(time + handle(random) * 100, value(random)));
+    }
+    FloatKeyFrame::PrepareSegments(keyFrames);
+
+    float newtonSum = 0;
+    float precomputedSum = 0;
+    auto newton = measureMicroseconds(10, [&]() {
+        for (size_t i = 0; i < segmentCount; ++i) {
+            auto& keyFrame = keyFrames[i];
+            auto& next = keyFrames[i + 1];
+            vec2 p0(keyFrame.getTime().count(), keyFrame.getValue());
+            vec2 p3(next.getTime().count(), next.getValue());
+            for (size_t sample = 0; sample < sampleCount; ++sample) {
+                auto t = static_cast<float>(sample) / sampleCount;
+                newtonSum += evaluateBezierNewton(p0, keyFrame.getBezierRight(),
+                                                  next.getBezierLeft(), p3, p0.x + t * 100);
+            }
+        }
+    });
+    auto precomputed = measureMicroseconds(10, [&]() {
+        for (size_t i = 0; i < segmentCount; ++i) {
+            for (size_t sample = 0; sample < sampleCount; ++sample) {
+                auto t = static_cast<float>(sample) / sampleCount;
+                precomputedSum += keyFrames[i].getValueAt(keyFrames[i + 1], t);
+            }
+        }
+    });
+
+    IVL_LOG(Info, "{} Bezier samples : Newton iteration {:.1f}us, precomputed segments {:.1f}us",
+            segmentCount * sampleCount, newton, precomputed);
+
+    REQUIRE(precomputedSum == Approx(newtonSum).epsilon(1e-3));
+}
+
+SCENARIO("Track strip lookup benchmark", "[.][benchmark]")
+{
+    const size_t stripCount = 1000;
+    const size_t seekCount = 10000;
+
+    World world;
+    auto entity = world.createEntity(1, "Entity");
+
+    vector<Action> actions;
+    vector<Track::Strip> strips;
+    for (size_t i = 0; i < stripCount; ++i) {
+        vector<unique_ptr<Channel>> channels;
+        channels.push_back(make_unique<TimeChannel>());
+        actions.emplace_back(i, "Action", move(channels));
+        strips.emplace_back("Strip", Milliseconds(i * 1000), Milliseconds(900), i, Milliseconds(0),
+                            Milliseconds(900));
+    }
+    Track track("Track", strips, Channel::Target(*entity));
+
+    mt19937 random(1);
+    uniform_int_distribution<int> seek(0, static_cast<int>(stripCount * 1000));
+    vector<Milliseconds> seekTimes;
+    for (size_t i = 0; i < seekCount; ++i) {
+        seekTimes.emplace_back(seek(random));
+    }
+
+    size_t linearSum = 0;
+    auto linear = measureMicroseconds(10, [&]() {
+        for (auto time : seekTimes) {
+            linearSum += findStripLinear(strips, time);
+        }
+    });
+    auto indexed = measureMicroseconds(10, [&]() {
+        for (auto time : seekTimes) {
+            track.update(actions, time);
+        }
+    });
+    auto playback = measureMicroseconds(10, [&]() {
+        for (size_t time = 0; time < stripCount * 1000; time += 16) {
+            track.update(actions, Milliseconds(time));
+        }
+    });
+
+    IVL_LOG(Info,
+            "{} seeks over {} strips : linear walk {:.1f}us, strip index {:.1f}us, playback of {} "
+            "updates {:.1f}us",
+            seekCount, stripCount, linear, indexed, stripCount * 1000 / 16, playback);
+
+    REQUIRE(linearSum > 0);
+}
+
+SCENARIO("Sampled channel load benchmark", "[.][benchmark]")
+{
+    const size_t channelCount = 1000;
+    const size_t sampleCount = 300;
+
+    // resource data shared by all channels, stands in for scene resource buffer
+    mt19937 random(1);
+    uniform_int_distribution<int> sample(0, 65535);
+    vector<uint16_t> translationScales(sampleCount * 4);
+    vector<uint16_t> rotations(sampleCount * 3);
+    for (auto& value : translationScales) {
+        value = static_cast<uint16_t>(sample(random));
+    }
+    for (auto& value : rotations) {
+        value = static_cast<uint16_t>(sample(random));
+    }
+
+    auto load = [&](bool reference) {
+        vector<QuantizedPoseSamples> channels;
+        channels.reserve(channelCount);
+        for (size_t i = 0; i < channelCount; ++i) {
+            if (reference) {
+                channels.emplace_back(
+                    Milliseconds(0), 30, vec4(0), vec4(1),
+                    ChannelData<uint16_t>::Reference(translationScales.data(),
+                                                     translationScales.size()),
+                    ChannelData<uint16_t>::Reference(rotations.data(), rotations.size()));
+            }
+            else {
+                channels.emplace_back(Milliseconds(0), 30, vec4(0), vec4(1),
+                                      vector<uint16_t>(translationScales.begin(),
+                                                       translationScales.end()),
+                                      vector<uint16_t>(rotations.begin(), rotations.end()));
+            }
+        }
+        return channels;
+    };
+
+    size_t sampleSum = 0;
+    auto copied = measureMicroseconds(10, [&]() { sampleSum += load(false).size(); });
+    auto referenced = measureMicroseconds(10, [&]() { sampleSum += load(true).size(); });
+
+    IVL_LOG(Info,
+            "Loading {} pose channels of {} samples : copied {:.1f}us ({} KB), referenced "
+            "{:.1f}us (0 KB)",
+            channelCount, sampleCount, copied,
+            channelCount * sampleCount * 7 * sizeof(uint16_t) / 1024, referenced);
+
+    REQUIRE(sampleSum == channelCount * 20);
+}
@@ -0,0 +1,139 @@
+#include <catch.hpp>
+#include <random>
+#include <ipp/scene/node/node.hpp>
+#include <ipp/task/threadpool.hpp>
+#include "benchmark.hpp"
+#include "nodetransformreference.hpp"
+
+using namespace std;
+using namespace glm;
+using namespace ipp;
+using namespace ipp::task;
+using namespace ipp::scene::node;
+
+namespace {
+/**
+ * @brief Measure full hierarchy update (root marked dirty) sequentially and on threadPool.
+ */
+void benchmarkHierarchy(const string& topology,
+                        Node& root,
+                        const vector<unique_ptr<Node>>& nodes,
+                        ThreadPool& threadPool)
+{
+    const size_t repeat = 20;
+
+    root.updateTransform();
+    auto sequential = measureMicroseconds(repeat, [&]() {
+        root.getTransform().translation.x += 1.0f;
+        root.updateTransform();
+    });
+    auto parallel = measureMicroseconds(repeat, [&]() {
+        root.getTransform().translation.x += 1.0f;
+        root.updateTransform(threadPool);
+    });
+
+    IVL_LOG(Info, "{} nodes {} hierarchy update : sequential {:.1f}us, {} workers {:.1f}us",
+            nodes.size(), topology, sequential, threadPool.getWorkerCount(), parallel);
+
+    REQUIRE(root.getHierarchy().getUpdatedCount() == nodes.size() + 1);
+}
+}
+
+SCENARIO("Node hierarchy update benchmark", "[.][benchmark]")
+{
+    const size_t nodeCount = 50000;
+    ThreadPool threadPool(ThreadPool::GetDefaultWorkerCount());
+
+    Node root;
+    vector<unique_ptr<Node>> nodes;
+    auto createNode = [&nodes](Node& parent) -> Node& {
+        nodes.push_back(make_unique<Node>());
+        nodes.back()->getTransform().translation = vec3(1.0f, 0.5f, 0.25f);
+        nodes.back()->getTransform().rotation = vec4(0.1f, 0.2f, 0.3f, 0.0f);
+        parent.addChild(nodes.back().get(), mat4());
+        return *nodes.back();
+    };
+
+    GIVEN("Deep chain hierarchy")
+    {
+        Node* parent = &root;
+        for (size_t i = 0; i < nodeCount; ++i) {
+            parent = &createNode(*parent);
+        }
+        benchmarkHierarchy("deep chain", root, nodes, threadPool);
+    }
+
+    GIVEN("Wide flat hierarchy")
+    {
+        for (size_t i = 0; i < nodeCount; ++i) {
+            createNode(root);
+        }
+        benchmarkHierarchy("wide flat", root, nodes, threadPool);
+    }
+
+    GIVEN("Mixed topology hierarchy")
+    {
+        // few large subtrees made of short chains with leaf fan out
+        while (nodes.size() < nodeCount) {
+            auto& group = createNode(root);
+            for (size_t chain = 0; chain < 100 && nodes.size() < nodeCount; ++chain) {
+                auto* parent = &createNode(group);
+                for (size_t depth = 0; depth < 4; ++depth) {
+                    parent = &createNode(*parent);
+                }
+                for (size_t leaf = 0; leaf < 8; ++leaf) {
+                    createNode(*parent);
+                }
+            }
+        }
+        benchmarkHierarchy("mixed", root, nodes, threadPool);
+    }
+}
+
+SCENARIO("Node transform composition benchmark", "[.][benchmark]")
+{
+    const size_t transformCount = 100000;
+    const size_t repeat = 10;
+    const char* modeNames[] = {"Quaternion", "AxisAngle", "EulerXYZ", "EulerXZY",
+                               "EulerYXZ",   "EulerYZX",  "EulerZXY", "EulerZYX"};
+
+    mt19937 random(42);
+    uniform_real_distribution<float> value(-2.0f, 2.0f);
+    vector<NodeTransform> transforms(transformCount);
+    vector<mat4> referenceMatrices(transformCount);
+    vector<mat4> matrices(transformCount);
+
+    for (size_t mode = 0; mode < 8; ++mode) {
+        for (auto& transform : transforms) {
+            transform.translation = vec3(value(random), value(random), value(random));
+            transform.rotation = vec4(value(random), value(random), value(random), value(random));
+            transform.scale = vec3(value(random), value(random), value(random));
+            transform.rotationMode = static_cast<NodeTransform::RotationMode>(mode);
+        }
+
+        auto reference = measureMicroseconds(repeat, [&]() {
+            for (size_t i = 0; i < transformCount; ++i) {
+                referenceMatrices[i] = composeReferenceMatrix(transforms[i]);
+            }
+        });
+        auto batch = measureMicroseconds(repeat, [&]() {
+            composeTransformMatrices(transforms.data(), transformCount, matrices.data());
+        });
+
+        IVL_LOG(Info, "{} {} transforms composition : glm reference {:.1f}us, batch {:.1f}us",
+                transformCount, modeNames[mode], reference, batch);
+
+        size_t mismatchCount = 0;
+        for (size_t i = 0; i < transformCount; ++i) {
+            for (int column = 0; column < 4; ++column) {
+                for (int row = 0; row < 4; ++row) {
+                    auto a = matrices[i][column][row];
+                    auto b = referenceMatrices[i][column][row];
+                    auto tolerance = 1e-4f * std::max(std::abs(a), std::abs(b)) + 1e-5f;
+                    mismatchCount += std::abs(a - b) > tolerance;
+                }
+            }
+        }
+        REQUIRE(mismatchCount == 0);
+    }
+}
@@ -0,0 +1,109 @@
+#include <catch.hpp>
+#include <ipp/entity/world.hpp>
+#include <ipp/entity/worldsnapshot.hpp>
+#include "benchmark.hpp"
+
+using namespace std;
+using namespace ipp;
+using namespace ipp::entity;
+
+namespace {
+/**
+ * @brief Component with snapshot state sized like NodeComponent transform and hidden flag.
+ */
+class SnapshotComponent final : public ComponentT<SnapshotComponent> {
+public:
+    SnapshotComponent(Entity& entity)
+        : ComponentT<SnapshotComponent>(entity)
+    {
+    }
+
+    size_t getSnapshotSize() const override
+    {
+        return sizeof(state);
+    }
+
+    void writeSnapshot(uint8_t* buffer) const override
+    {
+        memcpy(buffer, state, sizeof(state));
+    }
+
+    void readSnapshot(const uint8_t* buffer) override
+    {
+        memcpy(state, buffer, sizeof(state));
+    }
+
+    float state[12];
+    static const string ComponentTypeName;
+};
+
+const string SnapshotComponent::ComponentTypeName = "BenchmarkSnapshotComponent";
+}
+
+SCENARIO("World entity storage benchmark", "[.][benchmark]")
+{
+    const uint32_t entityCount = 20000;
+    const size_t repeat = 100;
+
+    World world;
+    unordered_map<uint32_t, unique_ptr<Entity>> entityMap;
+    for (uint32_t id = 1; id <= entityCount; ++id) {
+        auto name = "Entity" + to_string(id);
+        world.createEntity(id, name);
+        entityMap.emplace(id, make_unique<Entity>(world, id, name));
+    }
+
+    uint64_t checksum = 0;
+    auto storageIterate = measureMicroseconds(repeat, [&]() {
+        for (auto entity : world.getEntities()) {
+            checksum += entity->getId();
+        }
+    });
+    auto mapIterate = measureMicroseconds(repeat, [&]() {
+        for (auto& entity : entityMap) {
+            checksum += entity.second->getId();
+        }
+    });
+    auto storageLookup = measureMicroseconds(repeat, [&]() {
+        for (uint32_t id = 1; id <= entityCount; ++id) {
+            checksum += world.findEntity(id)->getId();
+        }
+    });
+    auto mapLookup = measureMicroseconds(repeat, [&]() {
+        for (uint32_t id = 1; id <= entityCount; ++id) {
+            checksum += entityMap.find(id)->second->getId();
+        }
+    });
+
+    IVL_LOG(Info, "{} entities iteration : EntityStorage {:.1f}us, unordered_map {:.1f}us",
+            entityCount, storageIterate, mapIterate);
+    IVL_LOG(Info, "{} entities lookup : EntityStorage {:.1f}us, unordered_map {:.1f}us",
+            entityCount, storageLookup, mapLookup);
+
+    REQUIRE(checksum > 0);
+}
+
+SCENARIO("World snapshot benchmark", "[.][benchmark]")
+{
+    const uint32_t entityCount = 20000;
+    const size_t repeat = 100;
+
+    World world;
+    for (uint32_t id = 1; id <= entityCount; ++id) {
+        auto component = world.createEntity(id, "Entity" + to_string(id))
+                             ->createComponent<SnapshotComponent>();
+        fill(begin(component->state), end(component->state), static_cast<float>(id));
+    }
+
+    WorldSnapshot snapshot;
+    snapshot.capture(world);
+
+    auto capture = measureMicroseconds(repeat, [&]() { snapshot.capture(world); });
+    auto restore = measureMicroseconds(repeat, [&]() { snapshot.restore(world); });
+
+    IVL_LOG(Info, "{} entities snapshot ({} bytes) : capture {:.1f}us, restore {:.1f}us",
+            entityCount, snapshot.getSize(), capture, restore);
+
+    REQUIRE(world.findEntity(entityCount)->findComponent<SnapshotComponent>()->state[0] ==
+            entityCount);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <ipp/scene/node/nodetransform.hpp>
+
+/**
+ * @brief Reference transform matrix built from separate glm translate/rotation/scale matrices.
+ */
+inline glm::mat4 composeReferenceMatrix(const ipp::scene::node::NodeTransform& transform)
+{
+    using namespace glm;
+    using ipp::scene::node::NodeTransform;
+
+    auto& rotation = transform.rotation;
+    mat4 rotationMatrix;
+    auto rotationX = eulerAngleX(rotation.x);
+    auto rotationY = eulerAngleY(rotation.y);
+    auto rotationZ = eulerAngleZ(rotation.z);
+    switch (transform.rotationMode) {
+        case NodeTransform::RotationMode::Quaternion:
+            rotationMatrix = toMat4(quat(rotation.w, rotation.x, rotation.y, rotation.z));
+            break;
+        case NodeTransform::RotationMode::AxisAngle:
+            rotationMatrix = axisAngleMatrix(vec3(rotation), rotation.w);
+            break;
+        case NodeTransform::RotationMode::EulerXYZ:
+            rotationMatrix = rotationZ * rotationY * rotationX;
+            break;
+        case NodeTransform::RotationMode::EulerXZY:
+            rotationMatrix = rotationY * rotationZ * rotationX;
+            break;
+        case NodeTransform::RotationMode::EulerYXZ:
+            rotationMatrix = rotationZ * rotationX * rotationY;
+            break;
+        case NodeTransform::RotationMode::EulerYZX:
+            rotationMatrix = rotationX * rotationZ * rotationY;
+            break;
+        case NodeTransform::RotationMode::EulerZXY:
+            rotationMatrix = rotationY * rotationX * rotationZ;
+            break;
+        case NodeTransform::RotationMode::EulerZYX:
+            rotationMatrix = rotationX * rotationY * rotationZ;
+            break;
+    }
+    return translate(transform.translation) * rotationMatrix * scale(transform.scale);
+}
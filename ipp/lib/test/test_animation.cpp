@@ -0,0 +1,1143 @@
+#include <catch.hpp>
+#include <random>
+#include <ipp/entity/world.hpp>
+#include <ipp/scene/animation/channel.hpp>
+#include <ipp/scene/animation/channeldata.hpp>
+#include <ipp/scene/animation/entitysequencegroups.hpp>
+#include <ipp/scene/animation/evaluationscheduler.hpp>
+#include <ipp/scene/animation/sampledchannel.hpp>
+#include <ipp/scene/animation/staticchannel.hpp>
+#include <ipp/scene/animation/track.hpp>
+#include <ipp/scene/animation/vectorchannel.hpp>
+#include <ipp/scene/node/nodecomponent.hpp>
+#include <ipp/scene/spatial/bounds.hpp>
+
+using namespace std;
+using namespace glm;
+using namespace ipp;
+using namespace ipp::entity;
+using namespace ipp::render;
+using namespace ipp::scene::animation;
+using namespace ipp::scene::node;
+using namespace ipp::scene::spatial;
+using namespace ipp::task;
+
+namespace {
+/**
+ * @brief Entity component animated by test channels.
+ */
+class ValueComponent final : public ComponentT<ValueComponent> {
+public:
+    ValueComponent(Entity& entity)
+        : ComponentT<ValueComponent>(entity)
+        , value{0}
+    {
+    }
+
+    float value;
+    vec4 vector;
+    static const string ComponentTypeName;
+};
+
+const string ValueComponent::ComponentTypeName = "ValueComponent";
+
+/**
+ * @brief Channel property binding entity ValueComponent value.
+ */
+struct ValueProperty {
+    typedef ValueComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<ValueComponent>();
+    }
+
+    static void update(float value, size_t, Binding component)
+    {
+        if (component != nullptr) {
+            component->value = value;
+        }
+    }
+};
+
+/**
+ * @brief Channel property binding entity ValueComponent value that counts writes in vector x.
+ */
+struct CountedValueProperty {
+    typedef ValueComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<ValueComponent>();
+    }
+
+    static void update(float value, size_t, Binding component)
+    {
+        component->value = value;
+        component->vector.x += 1;
+    }
+};
+
+/**
+ * @brief Channel property binding entity ValueComponent vector.
+ */
+struct VectorProperty {
+    typedef ValueComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<ValueComponent>();
+    }
+
+    static void update(float value, size_t propertyPath, Binding component)
+    {
+        component->vector[propertyPath] = value;
+    }
+
+    static void update(const vec4& value, size_t componentMask, Binding component)
+    {
+        for (size_t i = 0; i < VectorKeyFrames::ComponentCount; ++i) {
+            if (componentMask & (1 << i)) {
+                component->vector[i] = value[i];
+            }
+        }
+    }
+};
+
+/**
+ * @brief Entity component with bone poses animated by test channels.
+ */
+class PoseComponent final : public ComponentT<PoseComponent> {
+public:
+    PoseComponent(Entity& entity)
+        : ComponentT<PoseComponent>(entity)
+        , poses(4)
+    {
+    }
+
+    vector<Armature::Bone::Pose> poses;
+    static const string ComponentTypeName;
+};
+
+const string PoseComponent::ComponentTypeName = "PoseComponent";
+
+/**
+ * @brief Channel property binding entity PoseComponent pose, property path is pose index.
+ */
+struct PoseProperty {
+    typedef PoseComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<PoseComponent>();
+    }
+
+    static void update(Armature::Bone::Pose value, size_t propertyPath, Binding component)
+    {
+        component->poses[propertyPath] = value;
+    }
+};
+
+/**
+ * @brief Channel property binding entity NodeComponent translation, property path is axis.
+ */
+struct NodeTranslationProperty {
+    typedef NodeComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<NodeComponent>();
+    }
+
+    static void update(float value, size_t propertyPath, Binding node)
+    {
+        node->getTransform().translation[propertyPath] = value;
+    }
+};
+
+/**
+ * @brief Channel property binding entity NodeComponent hidden flag.
+ */
+struct NodeHiddenProperty {
+    typedef NodeComponent* Binding;
+
+    static Binding bind(size_t, Channel::Target target)
+    {
+        return target.getEntity().findComponent<NodeComponent>();
+    }
+
+    static void update(bool value, size_t, Binding node)
+    {
+        node->setHidden(value);
+    }
+};
+
+/**
+ * @brief Channel writing Action index and Action time to ValueComponent value and vector x.
+ */
+class ActionTimeChannel final : public Channel {
+private:
+    float _actionIndex;
+    ValueComponent* _component;
+
+public:
+    ActionTimeChannel(size_t actionIndex)
+        : _actionIndex{static_cast<float>(actionIndex)}
+        , _component{nullptr}
+    {
+    }
+
+    void bind(Channel::Target target) override
+    {
+        _component = target.getEntity().findComponent<ValueComponent>();
+    }
+
+    void updateTarget(Milliseconds time) override
+    {
+        _component->value = _actionIndex;
+        _component->vector.x = static_cast<float>(time.count());
+    }
+};
+
+/**
+ * @brief Linear interpolated key frame used to observe which key frame interval gets evaluated.
+ */
+class LinearKeyFrame final {
+private:
+    Milliseconds _time;
+    float _value;
+
+public:
+    LinearKeyFrame(Milliseconds time, float value)
+        : _time{time}
+        , _value{value}
+    {
+    }
+
+    Milliseconds getTime() const
+    {
+        return _time;
+    }
+
+    float getValueAt(const LinearKeyFrame& next, float t) const
+    {
+        return _value * (1 - t) + next._value * t;
+    }
+};
+
+/**
+ * @brief Reference Bezier segment value, handles are corrected like Blender fcurve segments and
+ *        curve parameter is found by bisection on de Casteljau evaluated time.
+ */
+double evaluateBezierReference(vec2 p0, vec2 p1, vec2 p2, vec2 p3, double time)
+{
+    double x[] = {p0.x, p1.x, p2.x, p3.x};
+    double y[] = {p0.y, p1.y, p2.y, p3.y};
+    auto length = x[3] - x[0];
+    auto handlesLength = std::abs(x[0] - x[1]) + std::abs(x[3] - x[2]);
+    if (handlesLength > length) {
+        auto factor = length / handlesLength;
+        for (auto p : {x, y}) {
+            p[1] = p[0] - factor * (p[0] - p[1]);
+            p[2] = p[3] - factor * (p[3] - p[2]);
+        }
+    }
+
+    auto evaluate = [](const double* p, double s) {
+        double points[] = {p[0], p[1], p[2], p[3]};
+        for (int count = 3; count > 0; --count) {
+            for (int i = 0; i < count; ++i) {
+                points[i] += (points[i + 1] - points[i]) * s;
+            }
+        }
+        return points[0];
+    };
+
+    double low = 0, high = 1;
+    for (int i = 0; i < 60; ++i) {
+        auto middle = (low + high) / 2;
+        (evaluate(x, middle) < time ? low : high) = middle;
+    }
+    return evaluate(y, (low + high) / 2);
+}
+
+/**
+ * @brief Reference key frame lookup scanning key frames from first one.
+ */
+float evaluateReference(const vector<LinearKeyFrame>& keyFrames, Milliseconds time)
+{
+    auto it = keyFrames.begin();
+    auto itPrevious = it;
+    while (it != keyFrames.end() && it->getTime() < time) {
+        itPrevious = it;
+        ++it;
+    }
+
+    float t = 1;
+    if (it == keyFrames.end()) {
+        it = itPrevious;
+    }
+    else {
+        auto dt = time - itPrevious->getTime();
+        auto duration = it->getTime() - itPrevious->getTime();
+        t = static_cast<float>(dt.count()) / static_cast<float>(duration.count());
+        t = std::max(0.0f, std::min(1.0f, t));
+    }
+    return itPrevious->getValueAt(*it, t);
+}
+}
+
+SCENARIO("Key frame channel test")
+{
+    GIVEN("Channel with key frames")
+    {
+        World world;
+        auto entity = world.createEntity(1, "Entity");
+        auto component = entity->createComponent<ValueComponent>();
+
+        vector<LinearKeyFrame> keyFrames;
+        for (int i = 0; i < 200; ++i) {
+            keyFrames.emplace_back(Milliseconds(i * 10 + (i % 3)), static_cast<float>(i * i % 17));
+        }
+        KeyFrameChannel<float, LinearKeyFrame, ValueProperty> channel(0, keyFrames);
+        channel.bind(*entity);
+
+        auto requireMatchesReference = [&](Milliseconds time) {
+            channel.updateTarget(time);
+            REQUIRE(component->value == evaluateReference(keyFrames, time));
+        };
+
+        THEN("Forward playback must match linear key frame scan")
+        {
+            for (int time = -20; time < 2100; time += 3) {
+                requireMatchesReference(Milliseconds(time));
+            }
+        }
+
+        THEN("Backward playback and seeks must match linear key frame scan")
+        {
+            for (int time = 2100; time > -20; time -= 7) {
+                requireMatchesReference(Milliseconds(time));
+            }
+
+            mt19937 random(3);
+            uniform_int_distribution<int> seek(-50, 2100);
+            for (int i = 0; i < 500; ++i) {
+                requireMatchesReference(Milliseconds(seek(random)));
+            }
+        }
+
+        THEN("Times exactly at key frames must match linear key frame scan")
+        {
+            for (auto& keyFrame : keyFrames) {
+                requireMatchesReference(keyFrame.getTime());
+            }
+        }
+
+        THEN("Rebound channel must update replacement component")
+        {
+            entity->removeComponent(component);
+            channel.bind(*entity);
+            channel.updateTarget(Milliseconds(15));
+
+            component = entity->createComponent<ValueComponent>();
+            channel.bind(*entity);
+            requireMatchesReference(Milliseconds(15));
+        }
+    }
+}
+
+SCENARIO("Track strip lookup test")
+{
+    GIVEN("Track with strips separated by gaps")
+    {
+        World world;
+        auto entity = world.createEntity(1, "Entity");
+        auto component = entity->createComponent<ValueComponent>();
+
+        mt19937 random(13);
+        uniform_int_distribution<int> length(1, 20);
+        vector<Action> actions;
+        vector<Track::Strip> strips;
+        int offset = 0;
+        for (size_t i = 0; i < 300; ++i) {
+            vector<unique_ptr<Channel>> channels;
+            channels.push_back(make_unique<ActionTimeChannel>(i));
+            actions.emplace_back(i, "Action", move(channels));
+            actions.back().bind(*entity);
+
+            // even offsets and durations, odd lookup times never hit strip boundaries
+            auto duration = length(random) * 2;
+            strips.emplace_back("Strip", Milliseconds(offset), Milliseconds(duration), i,
+                                Milliseconds(1000), Milliseconds(duration * 3));
+            offset += duration + (i % 3) * 2;
+        }
+        Track track("Track", strips, Channel::Target(*entity));
+
+        auto requireMatchesReference = [&](int time) {
+            track.update(actions, Milliseconds(time));
+
+            // last strip starting before time, first strip if there is none
+            size_t index = 0;
+            while (index + 1 < strips.size() && strips[index + 1].getTrackOffset().count() < time) {
+                index++;
+            }
+            auto& strip = strips[index];
+            auto stripTime = std::min<int64_t>(time - strip.getTrackOffset().count(),
+                                               strip.getTrackDuration().count() + 1);
+            auto ratio = static_cast<double>(stripTime) / strip.getTrackDuration().count();
+            REQUIRE(component->value == index);
+            REQUIRE(component->vector.x ==
+                    1000 + static_cast<int64_t>(strip.getActionDuration().count() * ratio));
+        };
+
+        THEN("Playback must apply strip starting last before time")
+        {
+            for (int time = -9; time < offset + 50; time += 2) {
+                requireMatchesReference(time);
+            }
+        }
+
+        THEN("Seeks must apply strip starting last before time")
+        {
+            uniform_int_distribution<int> seek(-50, offset + 50);
+            for (int i = 0; i < 1000; ++i) {
+                requireMatchesReference(seek(random) | 1);
+            }
+        }
+    }
+}
+
+SCENARIO("Const key frame channel test")
+{
+    GIVEN("Const key frame channel")
+    {
+        World world;
+        auto entity = world.createEntity(1, "Entity");
+        auto component = entity->createComponent<ValueComponent>();
+
+        vector<ConstKeyFrameT<float>> keyFrames;
+        for (int i = 0; i < 20; ++i) {
+            keyFrames.emplace_back(Milliseconds(i * 100), static_cast<float>(i));
+        }
+        ConstKeyFrameChannel<float, CountedValueProperty> channel(0, keyFrames);
+        KeyFrameChannel<float, ConstKeyFrameT<float>, ValueProperty> reference(0, keyFrames);
+        channel.bind(*entity);
+        reference.bind(*entity);
+
+        auto requireMatchesReference = [&](Milliseconds time) {
+            channel.updateTarget(time);
+            auto value = component->value;
+            reference.updateTarget(time);
+            REQUIRE(value == component->value);
+        };
+
+        THEN("Target must be written only on key frame transitions")
+        {
+            for (int time = -50; time < 2100; time += 5) {
+                channel.updateTarget(Milliseconds(time));
+            }
+            REQUIRE(component->vector.x == keyFrames.size());
+        }
+
+        THEN("Values must match key frame channel on playback and seeks")
+        {
+            for (int time = -50; time < 2100; time += 5) {
+                requireMatchesReference(Milliseconds(time));
+            }
+            for (auto& keyFrame : keyFrames) {
+                requireMatchesReference(keyFrame.getTime());
+            }
+
+            mt19937 random(9);
+            uniform_int_distribution<int> seek(-50, 2100);
+            for (int i = 0; i < 200; ++i) {
+                requireMatchesReference(Milliseconds(seek(random)));
+            }
+        }
+
+        THEN("Reset must write current key frame again")
+        {
+            channel.updateTarget(Milliseconds(250));
+            component->value = -1;
+            channel.updateTarget(Milliseconds(260));
+            REQUIRE(component->value == -1);
+
+            channel.reset();
+            channel.updateTarget(Milliseconds(260));
+            REQUIRE(component->value == 2);
+        }
+    }
+}
+
+SCENARIO("Channel data test")
+{
+    GIVEN("Channel data referencing and owning the same values")
+    {
+        vector<int32_t> buffer{0, 100, 200, 300};
+        auto reference = ChannelData<int32_t>::Reference(buffer.data(), buffer.size());
+        ChannelData<int32_t> owned(buffer);
+
+        THEN("Referenced values must be evaluated in place")
+        {
+            REQUIRE(reference.isReference());
+            REQUIRE(reference.data() == buffer.data());
+            REQUIRE_FALSE(owned.isReference());
+            REQUIRE(owned.data() != buffer.data());
+        }
+
+        THEN("Copies and moves must keep referencing or owning values")
+        {
+            auto referenceCopy = reference;
+            auto ownedCopy = owned;
+            REQUIRE(referenceCopy.data() == buffer.data());
+            REQUIRE(ownedCopy.data() != owned.data());
+            REQUIRE(vector<int32_t>(ownedCopy.begin(), ownedCopy.end()) == buffer);
+
+            auto ownedMoved = move(ownedCopy);
+            REQUIRE_FALSE(ownedMoved.isReference());
+            REQUIRE(ownedMoved[3] == 300);
+        }
+
+        THEN("Misaligned values must be copied")
+        {
+            vector<char> bytes(sizeof(int32_t) * 4 + 1);
+            memcpy(bytes.data() + 1, buffer.data(), sizeof(int32_t) * 4);
+            auto misaligned =
+                ChannelData<int32_t>::Reference(reinterpret_cast<int32_t*>(bytes.data() + 1), 4);
+            REQUIRE_FALSE(misaligned.isReference());
+            REQUIRE(vector<int32_t>(misaligned.begin(), misaligned.end()) == buffer);
+        }
+
+        THEN("Vector key frames must evaluate referenced values")
+        {
+            vector<float> values{0, 0, 0, 0, 1, 2, 3, 4, 1, 2, 3, 4, 0, 0, 0, 0};
+            VectorKeyFrames keyFrames(
+                reference, ChannelData<float>::Reference(values.data(), values.size()),
+                vector<FloatKeyFrame::InterpolationMode>(4,
+                                                         FloatKeyFrame::InterpolationMode::Linear));
+            REQUIRE(keyFrames.getValueAt(Milliseconds(50)) == vec4(0.5f, 1, 1.5f, 2));
+            REQUIRE(keyFrames.getValueAt(Milliseconds(150)) == vec4(1, 2, 3, 4));
+            REQUIRE(keyFrames.getValueAt(Milliseconds(400)) == vec4(0));
+        }
+    }
+}
+
+SCENARIO("Vector key frame channel test")
+{
+    GIVEN("Scalar channels with matching key frame times packed in to a vector channel")
+    {
+        World world;
+        auto scalarEntity = world.createEntity(1, "ScalarEntity");
+        auto vectorEntity = world.createEntity(2, "VectorEntity");
+        auto scalarComponent = scalarEntity->createComponent<ValueComponent>();
+        auto vectorComponent = vectorEntity->createComponent<ValueComponent>();
+
+        mt19937 random(5);
+        uniform_real_distribution<float> value(-10.0f, 10.0f);
+        vector<FloatKeyFrame> components[3];
+        for (int i = 0; i < 50; ++i) {
+            auto mode = i % 4 == 0 ? FloatKeyFrame::InterpolationMode::Constant
+                                   : FloatKeyFrame::InterpolationMode::Linear;
+            for (auto& keyFrames : components) {
+                keyFrames.emplace_back(Milliseconds(i * 40), value(random), mode, vec2(), vec2());
+            }
+        }
+
+        // components X, Z and W animated, Y left untouched
+        const vector<FloatKeyFrame>* packed[VectorKeyFrames::ComponentCount] = {
+            &components[0], nullptr, &components[1], &components[2]};
+        REQUIRE(VectorKeyFrames::canPack(packed));
+
+        vector<unique_ptr<Channel>> scalarChannels;
+        size_t paths[] = {0, 2, 3};
+        for (size_t i = 0; i < 3; ++i) {
+            scalarChannels.push_back(
+                make_unique<KeyFrameChannel<float, FloatKeyFrame, VectorProperty>>(paths[i],
+                                                                                   components[i]));
+            scalarChannels.back()->bind(*scalarEntity);
+        }
+        VectorKeyFrameChannel<VectorProperty> vectorChannel(1 | 4 | 8, VectorKeyFrames(packed));
+        vectorChannel.bind(*vectorEntity);
+
+        THEN("Vector channel must match scalar channels")
+        {
+            vectorComponent->vector.y = scalarComponent->vector.y = 7;
+            for (int time = -30; time < 2100; time += 7) {
+                for (auto& channel : scalarChannels) {
+                    channel->updateTarget(Milliseconds(time));
+                }
+                vectorChannel.updateTarget(Milliseconds(time));
+                for (int i = 0; i < 4; ++i) {
+                    REQUIRE(vectorComponent->vector[i] ==
+                            Approx(scalarComponent->vector[i]).margin(1e-5));
+                }
+            }
+        }
+
+        THEN("Key frames with different times or Bezier interpolation must not be packed")
+        {
+            components[2][3] = FloatKeyFrame(Milliseconds(125), 0,
+                                             FloatKeyFrame::InterpolationMode::Linear, vec2(),
+                                             vec2());
+            REQUIRE_FALSE(VectorKeyFrames::canPack(packed));
+
+            components[2] = components[0];
+            components[1][3] = FloatKeyFrame(Milliseconds(120), 0,
+                                             FloatKeyFrame::InterpolationMode::Bezier, vec2(),
+                                             vec2());
+            REQUIRE_FALSE(VectorKeyFrames::canPack(packed));
+        }
+    }
+}
+
+SCENARIO("Static channel elimination test")
+{
+    GIVEN("Two Actions animating vector components with constant and changing key frames")
+    {
+        World world;
+        auto entity = world.createEntity(1, "Entity");
+        auto component = entity->createComponent<ValueComponent>();
+        component->vector = vec4(0);
+
+        auto keyFrames = [](vector<float> values) {
+            vector<FloatKeyFrame> result;
+            for (size_t i = 0; i < values.size(); ++i) {
+                result.emplace_back(Milliseconds(i * 100), values[i],
+                                    FloatKeyFrame::InterpolationMode::Linear, vec2(), vec2());
+            }
+            return result;
+        };
+
+        // component 0 constant in both Actions, 1 constant in first Action only, 2 constant in
+        // first Action and empty in second, 3 constant but animated by a vector channel, 4
+        // constant at current value in first Action and empty in second
+        vector<FloatKeyFrame> actions[2][5] = {
+            {keyFrames({2, 2, 2}), keyFrames({3, 3}), keyFrames({4}), keyFrames({5, 5}),
+             keyFrames({0, 0})},
+            {keyFrames({2, 2}), keyFrames({3, 6}), keyFrames({}), keyFrames({5}), keyFrames({})}};
+        StaticChannelEliminator<FloatKeyFrame> eliminator(2);
+        for (size_t action = 0; action < 2; ++action) {
+            for (size_t key = 0; key < 5; ++key) {
+                eliminator.add(action, key, actions[action][key]);
+            }
+        }
+        eliminator.addAnimated(3);
+
+        auto eliminate = [&](size_t action, size_t key) {
+            auto createChannel = [&]() {
+                return make_unique<KeyFrameChannel<float, FloatKeyFrame, VectorProperty>>(
+                    key, actions[action][key]);
+            };
+            auto isCurrentValue = [&](const FloatKeyFrame& keyFrame) {
+                return component->vector[static_cast<int>(key)] == keyFrame.getValue();
+            };
+            return eliminator.eliminate(key, actions[action][key], createChannel, isCurrentValue);
+        };
+
+        THEN("Property constant in all Actions must be folded once and applied on every bind")
+        {
+            REQUIRE(eliminate(0, 0));
+            REQUIRE(eliminate(1, 0));
+            REQUIRE(component->vector[0] == 0);
+
+            auto staticChannels = eliminator.takeStaticChannels();
+            REQUIRE(staticChannels.size() == 1);
+            EntitySequence sequence(*entity, {}, {}, move(staticChannels));
+            sequence.bind();
+            REQUIRE(component->vector[0] == 2);
+
+            // recreated target component gets folded value when sequence is bound again
+            entity->removeComponent(component);
+            component = entity->createComponent<ValueComponent>();
+            component->vector = vec4(0);
+            sequence.bind();
+            REQUIRE(component->vector[0] == 2);
+        }
+
+        THEN("Property constant in one Action but animated in another must be kept")
+        {
+            REQUIRE_FALSE(eliminate(0, 1));
+            REQUIRE_FALSE(eliminate(1, 1));
+            REQUIRE_FALSE(eliminate(0, 3));
+            REQUIRE_FALSE(eliminate(1, 3));
+            REQUIRE(eliminator.takeStaticChannels().empty());
+        }
+
+        THEN("Property constant in one Action and absent in another must be kept")
+        {
+            REQUIRE(eliminate(1, 2));
+            REQUIRE_FALSE(eliminate(0, 2));
+            REQUIRE(eliminator.takeStaticChannels().empty());
+            REQUIRE(component->vector == vec4(0));
+        }
+
+        THEN("Property absent in one Action and constant at current value must be eliminated")
+        {
+            REQUIRE(eliminate(0, 4));
+            REQUIRE(eliminate(1, 4));
+            REQUIRE(eliminator.takeStaticChannels().empty());
+        }
+    }
+}
+
+SCENARIO("Bezier key frame test")
+{
+    GIVEN("Bezier segment with handles at one and two thirds of segment")
+    {
+        vector<FloatKeyFrame> keyFrames;
+        keyFrames.emplace_back(Milliseconds(0), 0.0f, FloatKeyFrame::InterpolationMode::Bezier,
+                               vec2(-1000.0f / 3, 0), vec2(1000.0f / 3, 0));
+        keyFrames.emplace_back(Milliseconds(1000), 1.0f, FloatKeyFrame::InterpolationMode::Bezier,
+                               vec2(2000.0f / 3, 1), vec2(4000.0f / 3, 1));
+        FloatKeyFrame::PrepareSegments(keyFrames);
+
+        THEN("Segment must evaluate to smoothstep")
+        {
+            REQUIRE(keyFrames[0].getValueAt(keyFrames[1], 0) == Approx(0).margin(1e-6));
+            REQUIRE(keyFrames[0].getValueAt(keyFrames[1], 0.25f) == Approx(0.15625));
+            REQUIRE(keyFrames[0].getValueAt(keyFrames[1], 0.5f) == Approx(0.5));
+            REQUIRE(keyFrames[0].getValueAt(keyFrames[1], 0.75f) == Approx(0.84375));
+            REQUIRE(keyFrames[0].getValueAt(keyFrames[1], 1) == Approx(1));
+        }
+
+        THEN("Channel must hold first and last values outside of key frame range")
+        {
+            KeyFrameChannel<float, FloatKeyFrame, ValueProperty> channel(0, keyFrames);
+            World world;
+            auto entity = world.createEntity(1, "Entity");
+            auto component = entity->createComponent<ValueComponent>();
+            channel.bind(*entity);
+
+            channel.updateTarget(Milliseconds(0));
+            REQUIRE(component->value == 0);
+            channel.updateTarget(Milliseconds(250));
+            REQUIRE(component->value == Approx(0.15625));
+            channel.updateTarget(Milliseconds(2000));
+            REQUIRE(component->value == 1);
+        }
+    }
+
+    GIVEN("Bezier segments with random handles")
+    {
+        mt19937 random(11);
+        uniform_real_distribution<float> unit(0.0f, 1.0f);
+        uniform_real_distribution<float> value(-5.0f, 5.0f);
+
+        THEN("Segment values must match reference curve")
+        {
+            for (int i = 0; i < 200; ++i) {
+                // every 4th segment gets handles anywhere in (or overlapping) segment range
+                auto spread = i % 4 == 0 ? 1.0f : 0.4f;
+                auto duration = 100 + i * 10;
+                vec2 p0(0, value(random));
+                vec2 p3(duration, value(random));
+                vec2 p1(unit(random) * spread * duration, value(random));
+                vec2 p2((1 - unit(random) * spread) * duration, value(random));
+
+                vector<FloatKeyFrame> keyFrames;
+                keyFrames.emplace_back(Milliseconds(0), p0.y,
+                                       FloatKeyFrame::InterpolationMode::Bezier, vec2(), p1);
+                keyFrames.emplace_back(Milliseconds(duration), p3.y,
+                                       FloatKeyFrame::InterpolationMode::Bezier, p2, vec2());
+                FloatKeyFrame::PrepareSegments(keyFrames);
+
+                for (int sample = 0; sample <= 100; ++sample) {
+                    auto t = sample / 100.0f;
+                    auto reference = evaluateBezierReference(p0, p1, p2, p3, t * duration);
+                    REQUIRE(keyFrames[0].getValueAt(keyFrames[1], t) ==
+                            Approx(reference).margin(1e-3));
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Sampled channel test")
+{
+    GIVEN("Vector values sampled at 30 samples per second")
+    {
+        vector<vec4> values;
+        for (int i = 0; i < 90; ++i) {
+            auto time = i / 30.0f;
+            values.emplace_back(sin(time) * 20, 0, time * time, -3);
+        }
+        auto samples = QuantizedVectorSamples::Quantize(Milliseconds(500), 30, 1 | 4 | 8, values);
+        REQUIRE(samples.size() == values.size());
+
+        THEN("Samples must match source values within quantization error")
+        {
+            for (size_t i = 0; i < values.size(); ++i) {
+                // sample times rounded to whole milliseconds, interpolation adds to error
+                auto value = samples.getValueAt(Milliseconds(500 + (i * 1000 + 15) / 30));
+                REQUIRE(value.x == Approx(values[i].x).margin(2e-2));
+                REQUIRE(value.y == 0);
+                REQUIRE(value.z == Approx(values[i].z).margin(2e-2));
+                REQUIRE(value.w == Approx(-3));
+            }
+            REQUIRE(samples.getValueAt(Milliseconds(0)).z == 0);
+            REQUIRE(samples.getValueAt(Milliseconds(10000)).z ==
+                    Approx(values.back().z).margin(1e-4));
+        }
+
+        THEN("Sampled channel must update target property")
+        {
+            World world;
+            auto entity = world.createEntity(1, "Entity");
+            auto component = entity->createComponent<ValueComponent>();
+            SampledChannel<QuantizedVectorSamples, VectorProperty> channel(1 | 4 | 8, samples);
+            channel.bind(*entity);
+            channel.updateTarget(Milliseconds(1500));
+            REQUIRE(component->vector.x == Approx(sin(1.0f) * 20).margin(1e-3));
+            REQUIRE(component->vector.z == Approx(1).margin(1e-3));
+        }
+    }
+
+    GIVEN("Random rotations")
+    {
+        mt19937 random(7);
+        uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        THEN("Smallest three encoded rotations must match source rotations")
+        {
+            for (int i = 0; i < 1000; ++i) {
+                auto rotation = normalize(quat(unit(random), unit(random), unit(random),
+                                               unit(random)));
+                uint16_t quantized[3];
+                QuantizedPoseSamples::QuantizeRotation(rotation, quantized);
+                auto decoded = QuantizedPoseSamples::DequantizeRotation(quantized);
+                // q and -q are same rotation
+                REQUIRE(std::abs(dot(rotation, decoded)) == Approx(1).margin(1e-4));
+            }
+        }
+
+        THEN("Pose samples must match source poses")
+        {
+            vector<Armature::Bone::Pose> poses;
+            for (int i = 0; i < 60; ++i) {
+                poses.emplace_back(vec3(unit(random), unit(random) * 4, i * 0.1f),
+                                   normalize(quat(unit(random), unit(random), unit(random),
+                                                  unit(random))),
+                                   1 + unit(random) * 0.5f);
+            }
+            auto samples = QuantizedPoseSamples::Quantize(Milliseconds(0), 20, poses);
+            for (size_t i = 0; i < poses.size(); ++i) {
+                auto pose = samples.getValueAt(Milliseconds(i * 50));
+                for (int component = 0; component < 3; ++component) {
+                    REQUIRE(pose.translation[component] ==
+                            Approx(poses[i].translation[component]).margin(1e-3));
+                }
+                REQUIRE(std::abs(dot(pose.rotation, poses[i].rotation)) ==
+                        Approx(1).margin(1e-4));
+                REQUIRE(pose.scale == Approx(poses[i].scale).margin(1e-3));
+            }
+        }
+    }
+}
+
+SCENARIO("Entity sequence groups test")
+{
+    GIVEN("Entities animated by two overlapping sequences each in two identical worlds")
+    {
+        // node transforms, hidden flags and poses of entity created in world with random seed
+        struct AnimatedWorld {
+            Node root;
+            World world;
+            vector<Entity*> entities;
+            unique_ptr<EntitySequenceGroups> groups;
+        };
+        auto createWorld = [](AnimatedWorld& animated) {
+            mt19937 random(17);
+            uniform_real_distribution<float> value(-10.0f, 10.0f);
+            uniform_int_distribution<int> flag(0, 1);
+            auto linear = FloatKeyFrame::InterpolationMode::Linear;
+
+            vector<EntitySequence> sequences;
+            for (uint32_t id = 1; id <= 100; ++id) {
+                auto entity = animated.world.createEntity(id, "Entity" + to_string(id));
+                animated.root.addChild(entity->createComponent<NodeComponent>(), mat4(1));
+                entity->createComponent<PoseComponent>();
+                animated.entities.push_back(entity);
+            }
+
+            // second sequence of every entity overwrites translation x written by first one
+            for (int sequence = 0; sequence < 2; ++sequence) {
+                for (auto entity : animated.entities) {
+                    vector<FloatKeyFrame> translations;
+                    vector<ConstKeyFrameT<bool>> hidden;
+                    vector<BonePoseKeyFrame> poses;
+                    for (int i = 0; i < 10; ++i) {
+                        auto time = Milliseconds(i * 200);
+                        translations.emplace_back(time, value(random), linear, vec2(), vec2());
+                        hidden.emplace_back(time, flag(random) != 0);
+                        poses.emplace_back(time, vec3(value(random)),
+                                           normalize(quat(value(random), value(random),
+                                                          value(random), value(random))),
+                                           value(random));
+                    }
+
+                    vector<unique_ptr<Channel>> channels;
+                    channels.push_back(
+                        make_unique<KeyFrameChannel<float, FloatKeyFrame, NodeTranslationProperty>>(
+                            0, move(translations)));
+                    channels.push_back(make_unique<ConstKeyFrameChannel<bool, NodeHiddenProperty>>(
+                        0, move(hidden)));
+                    channels.push_back(make_unique<
+                                       KeyFrameChannel<Armature::Bone::Pose, BonePoseKeyFrame,
+                                                       PoseProperty>>(sequence, move(poses)));
+                    vector<Action> actions;
+                    actions.emplace_back(0, "Action", move(channels));
+
+                    vector<Track::Strip> strips = {{"Strip", Milliseconds(sequence * 100),
+                                                    Milliseconds(2000), 0, Milliseconds(0),
+                                                    Milliseconds(2000)}};
+                    vector<Track> tracks;
+                    tracks.emplace_back("Track", move(strips), Channel::Target(*entity));
+                    sequences.emplace_back(*entity, move(actions), move(tracks));
+                    sequences.back().bind();
+                }
+            }
+            animated.groups = make_unique<EntitySequenceGroups>(move(sequences));
+        };
+
+        AnimatedWorld serial;
+        AnimatedWorld parallel;
+        createWorld(serial);
+        createWorld(parallel);
+        ThreadPool serialPool(0);
+        ThreadPool parallelPool(4);
+
+        THEN("Every entity must have one group")
+        {
+            REQUIRE(serial.groups->size() == serial.entities.size());
+            REQUIRE(serial.groups->find(*serial.entities[5]) == 5);
+            REQUIRE(serial.groups->getSequenceCount(5) == 2);
+            REQUIRE(serial.groups->isDiscrete(5));
+        }
+
+        THEN("Parallel updates must match serial updates")
+        {
+            vector<size_t> groups(serial.groups->size());
+            iota(groups.begin(), groups.end(), 0);
+            for (int time = -20; time < 2200; time += 16) {
+                serial.groups->update(serialPool, groups, Milliseconds(time));
+                parallel.groups->update(parallelPool, groups, Milliseconds(time));
+
+                for (size_t i = 0; i < serial.entities.size(); ++i) {
+                    const auto& serialNode = *serial.entities[i]->findComponent<NodeComponent>();
+                    const auto& node = *parallel.entities[i]->findComponent<NodeComponent>();
+                    REQUIRE(node.getTransform().translation ==
+                            serialNode.getTransform().translation);
+                    REQUIRE(node.getHidden() == serialNode.getHidden());
+
+                    auto& serialPoses = serial.entities[i]->findComponent<PoseComponent>()->poses;
+                    auto& poses = parallel.entities[i]->findComponent<PoseComponent>()->poses;
+                    for (size_t bone = 0; bone < poses.size(); ++bone) {
+                        REQUIRE(poses[bone].translation == serialPoses[bone].translation);
+                        REQUIRE(poses[bone].rotation == serialPoses[bone].rotation);
+                        REQUIRE(poses[bone].scale == serialPoses[bone].scale);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Evaluation scheduler test")
+{
+    GIVEN("Scheduler of 4 items with LOD and budget")
+    {
+        EvaluationScheduler::Settings settings;
+        settings.lodScreenSize = 0.1f;
+        settings.maxUpdateInterval = 4;
+        settings.budget = 1;
+        EvaluationScheduler scheduler(settings, 4);
+
+        // item 0 isn't throttled, 1 is large, 2 is small, 3 is off screen
+        auto scheduleFrame = [&scheduler]() {
+            scheduler.invalidate();
+            scheduler.begin();
+            for (size_t item = 1; item < 4; ++item) {
+                scheduler.throttle(item);
+            }
+            scheduler.raiseScreenSize(0, 0.01f);
+            scheduler.raiseScreenSize(1, 0.5f);
+            scheduler.raiseScreenSize(2, 0.03f);
+            return scheduler.schedule(false);
+        };
+
+        THEN("Update interval must double with every halving of screen size")
+        {
+            REQUIRE(scheduler.getUpdateInterval(0.5f) == 1);
+            REQUIRE(scheduler.getUpdateInterval(0.06f) == 2);
+            REQUIRE(scheduler.getUpdateInterval(0.03f) == 4);
+            REQUIRE(scheduler.getUpdateInterval(0.001f) == 4);
+            REQUIRE(scheduler.getUpdateInterval(0) == 0);
+        }
+
+        THEN("Every item must be scheduled when all items are requested")
+        {
+            scheduler.begin();
+            scheduler.throttle(3);
+            REQUIRE(scheduler.schedule(true) == vector<size_t>({0, 1, 2, 3}));
+        }
+
+        THEN("Throttled items must share budget and off screen items must be skipped")
+        {
+            vector<size_t> updates(4, 0);
+            for (int frame = 0; frame < 16; ++frame) {
+                auto scheduled = scheduleFrame();
+                REQUIRE(scheduled.front() == 0);
+                REQUIRE(scheduled.size() <= 2);
+                for (auto item : scheduled) {
+                    updates[item]++;
+                }
+            }
+            REQUIRE(updates[0] == 16);
+            REQUIRE(updates[1] + updates[2] == 16);
+            REQUIRE(updates[2] >= 3);
+            REQUIRE(updates[3] == 0);
+            REQUIRE(scheduler.getSkippedFrames(3) == 16);
+        }
+
+        THEN("Up to date items must only be evaluated after animation time changes")
+        {
+            scheduler.begin();
+            REQUIRE(scheduler.schedule(false) == vector<size_t>({0, 1, 2, 3}));
+            scheduler.begin();
+            REQUIRE(scheduler.schedule(false).empty());
+
+            // item skipped over budget catches up without time change
+            scheduler.invalidate();
+            scheduler.begin();
+            scheduler.throttle(1);
+            scheduler.throttle(2);
+            scheduler.raiseScreenSize(1, 0.5f);
+            scheduler.raiseScreenSize(2, 0.4f);
+            REQUIRE(scheduler.schedule(false) == vector<size_t>({0, 1, 3}));
+            scheduler.begin();
+            scheduler.throttle(1);
+            scheduler.throttle(2);
+            scheduler.raiseScreenSize(2, 0.4f);
+            REQUIRE(scheduler.schedule(false) == vector<size_t>({2}));
+            scheduler.begin();
+            REQUIRE(scheduler.schedule(false).empty());
+        }
+    }
+
+    GIVEN("Off screen node animated in to camera frustum")
+    {
+        World world;
+        auto entity = world.createEntity(1, "Node");
+        auto component = entity->createComponent<ValueComponent>();
+
+        // unit box at 5 units in front of camera moves along x from far left to view center
+        vector<LinearKeyFrame> keyFrames = {{Milliseconds(0), -20.0f}, {Milliseconds(1000), 0.0f}};
+        KeyFrameChannel<float, LinearKeyFrame, ValueProperty> channel(0, keyFrames);
+        channel.bind(*entity);
+        channel.updateTarget(Milliseconds(0));
+        Frustum frustum(perspective(radians(60.0f), 1.0f, 0.1f, 100.0f));
+        auto isVisible = [&frustum](float x) {
+            return frustum.intersects(BoundingBox(vec3(x - 0.5f, -0.5f, -5.5f),
+                                                  vec3(x + 0.5f, 0.5f, -4.5f)));
+        };
+
+        EvaluationScheduler::Settings settings;
+        settings.maxUpdateInterval = 4;
+        EvaluationScheduler scheduler(settings, 1);
+
+        // frames throttle node item with visibility of previously evaluated node position
+        auto playFrames = [&](bool cull) {
+            int firstVisibleFrame = -1;
+            for (int frame = 0; frame <= 60; ++frame) {
+                auto time = Milliseconds(frame * 16);
+                if (firstVisibleFrame < 0 && isVisible(evaluateReference(keyFrames, time))) {
+                    firstVisibleFrame = frame;
+                }
+
+                scheduler.invalidate();
+                scheduler.begin();
+                scheduler.throttle(0, cull);
+                if (isVisible(component->value)) {
+                    scheduler.raiseScreenSize(0, 0.5f);
+                }
+                for (auto item : scheduler.schedule(false)) {
+                    REQUIRE(item == 0);
+                    channel.updateTarget(time);
+                }
+
+                if (isVisible(component->value)) {
+                    return frame - firstVisibleFrame;
+                }
+            }
+            return -1;
+        };
+
+        THEN("Node that isn't culled must become visible within maximum update interval")
+        {
+            REQUIRE(!isVisible(component->value));
+            auto latency = playFrames(false);
+            REQUIRE(latency >= 0);
+            REQUIRE(latency < static_cast<int>(settings.maxUpdateInterval));
+            REQUIRE(scheduler.getUpdateInterval(0, false) == settings.maxUpdateInterval);
+        }
+
+        THEN("Culled node must stay at position it was culled at")
+        {
+            REQUIRE(playFrames(true) == -1);
+            REQUIRE(component->value == -20.0f);
+        }
+    }
+
+    GIVEN("Throttled items played to play end")
+    {
+        World world;
+        vector<LinearKeyFrame> keyFrames = {{Milliseconds(0), 0.0f}, {Milliseconds(1000), 1.0f}};
+        vector<ValueComponent*> components;
+        vector<unique_ptr<KeyFrameChannel<float, LinearKeyFrame, ValueProperty>>> channels;
+        for (uint32_t id = 1; id <= 4; ++id) {
+            auto entity = world.createEntity(id, "Entity" + to_string(id));
+            components.push_back(entity->createComponent<ValueComponent>());
+            channels.push_back(
+                make_unique<KeyFrameChannel<float, LinearKeyFrame, ValueProperty>>(0, keyFrames));
+            channels.back()->bind(*entity);
+        }
+
+        EvaluationScheduler::Settings settings;
+        settings.maxUpdateInterval = 4;
+        settings.budget = 1;
+        EvaluationScheduler scheduler(settings, 4);
+
+        // items are small, culled off screen or over budget, last frame reaches play end and
+        // evaluates every item that isn't up to date unthrottled as AnimationSystem does
+        Milliseconds playEnd(1000);
+        for (int frame = 0;; ++frame) {
+            auto time = std::min(Milliseconds(frame * 16), playEnd);
+            scheduler.invalidate();
+            scheduler.begin();
+            if (time != playEnd) {
+                scheduler.throttle(0);
+                scheduler.throttle(1);
+                scheduler.throttle(2, false);
+                scheduler.throttle(3);
+                scheduler.raiseScreenSize(0, 0.01f);
+                scheduler.raiseScreenSize(1, 0.5f);
+            }
+            for (auto item : scheduler.schedule(false)) {
+                channels[item]->updateTarget(time);
+            }
+            if (time == playEnd) {
+                break;
+            }
+        }
+
+        THEN("Every item must be evaluated at play end")
+        {
+            for (auto component : components) {
+                REQUIRE(component->value == 1.0f);
+            }
+            scheduler.begin();
+            REQUIRE(scheduler.schedule(false).empty());
+        }
+    }
+}
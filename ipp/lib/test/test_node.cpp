@@ -0,0 +1,249 @@
+#include <catch.hpp>
+#include <random>
+#include <ipp/entity/entitygroup.hpp>
+#include <ipp/entity/world.hpp>
+#include <ipp/scene/node/node.hpp>
+#include <ipp/scene/node/nodecomponent.hpp>
+#include <ipp/task/threadpool.hpp>
+#include "nodetransformreference.hpp"
+
+using namespace std;
+using namespace glm;
+using namespace ipp::entity;
+using namespace ipp::task;
+using namespace ipp::scene::node;
+
+SCENARIO("Node transform composition test")
+{
+    GIVEN("Random transforms in every rotation mode")
+    {
+        mt19937 random(7);
+        uniform_real_distribution<float> value(-2.0f, 2.0f);
+
+        vector<NodeTransform> transforms;
+        for (size_t i = 0; i < 8 * 9; ++i) {
+            NodeTransform transform;
+            transform.translation = vec3(value(random), value(random), value(random));
+            transform.rotation = vec4(value(random), value(random), value(random), value(random));
+            transform.scale = vec3(value(random), value(random), value(random));
+            // runs of equal modes so quaternion transforms are composed in SIMD batches
+            transform.rotationMode = static_cast<NodeTransform::RotationMode>(i / 9);
+            transforms.push_back(transform);
+        }
+
+        vector<mat4> matrices(transforms.size());
+        composeTransformMatrices(transforms.data(), transforms.size(), matrices.data());
+
+        THEN("Composed matrices must match glm matrix products")
+        {
+            for (size_t i = 0; i < transforms.size(); ++i) {
+                auto reference = composeReferenceMatrix(transforms[i]);
+                for (int column = 0; column < 4; ++column) {
+                    for (int row = 0; row < 4; ++row) {
+                        REQUIRE(matrices[i][column][row] ==
+                                Approx(reference[column][row]).epsilon(1e-4).margin(1e-5));
+                    }
+                }
+                REQUIRE(static_cast<mat4>(transforms[i]) == matrices[i]);
+            }
+        }
+    }
+}
+
+SCENARIO("Node hierarchy test")
+{
+    GIVEN("Node tree attached in breadth first order")
+    {
+        Node root;
+        Node childA;
+        Node childB;
+        Node grandChildA;
+        Node grandChildB;
+
+        root.addChild(&childA, mat4());
+        root.addChild(&childB, mat4());
+        childA.addChild(&grandChildA, mat4());
+        childB.addChild(&grandChildB, mat4());
+
+        childA.getTransform().translation = vec3(1, 0, 0);
+        childB.getTransform().translation = vec3(0, 1, 0);
+        grandChildA.getTransform().translation = vec3(0, 0, 1);
+        grandChildB.getTransform().scale = vec3(2);
+        root.updateTransform();
+
+        THEN("Hierarchy must be sorted so every subtree occupies a contiguous range")
+        {
+            auto& hierarchy = root.getHierarchy();
+            REQUIRE(hierarchy.isSorted());
+            REQUIRE(hierarchy.size() == 5);
+            REQUIRE(&grandChildA.getHierarchy() == &hierarchy);
+            REQUIRE(grandChildA.getHierarchyIndex() == childA.getHierarchyIndex() + 1);
+            REQUIRE(hierarchy.getSubtreeSize(root.getHierarchyIndex()) == 5);
+            REQUIRE(hierarchy.getSubtreeSize(childB.getHierarchyIndex()) == 2);
+            REQUIRE(grandChildB.getParent() == &childB);
+        }
+
+        THEN("World matrices must include parent transforms")
+        {
+            REQUIRE(grandChildA.getTransformMatrix()[3] == vec4(1, 0, 1, 1));
+            REQUIRE(grandChildB.getTransformMatrix()[3] == vec4(0, 1, 0, 1));
+            REQUIRE(grandChildB.getTransformMatrix()[0] == vec4(2, 0, 0, 0));
+        }
+
+        THEN("Only dirty subtrees must be recomputed")
+        {
+            REQUIRE(root.getHierarchy().getUpdatedCount() == 5);
+            root.updateTransform();
+            REQUIRE(root.getHierarchy().getUpdatedCount() == 0);
+
+            childA.getTransform().translation = vec3(2, 0, 0);
+            grandChildB.getTransform().translation = vec3(0, 0, 3);
+            root.updateTransform();
+            REQUIRE(root.getHierarchy().getUpdatedCount() == 3);
+            REQUIRE(grandChildA.getTransformMatrix()[3] == vec4(2, 0, 1, 1));
+            REQUIRE(grandChildB.getTransformMatrix()[3] == vec4(0, 1, 3, 1));
+        }
+
+        THEN("Requested cached matrices must follow world matrix changes")
+        {
+            root.getHierarchy().requestCachedMatrices(NodeHierarchy::NormalMatrixCache |
+                                                      NodeHierarchy::InverseWorldMatrixCache);
+            auto version = grandChildB.getTransformVersion();
+            root.updateTransform();
+            REQUIRE(grandChildB.getTransformVersion() > version);
+            REQUIRE(grandChildB.getNormalMatrix() == mat3(0.5f));
+            REQUIRE(grandChildB.getTransformInverseMatrix()[3] == vec4(0, -0.5f, 0, 1));
+
+            version = grandChildA.getTransformVersion();
+            childB.getTransform().translation = vec3(0, 2, 0);
+            root.updateTransform();
+            REQUIRE(grandChildA.getTransformVersion() == version);
+            REQUIRE(grandChildB.getTransformInverseMatrix()[3] == vec4(0, -1, 0, 1));
+        }
+
+        THEN("Hidden state must be inherited from parents")
+        {
+            childA.setHidden(true);
+            root.updateTransform();
+            REQUIRE(grandChildA.isHidden());
+            REQUIRE_FALSE(grandChildA.getHidden());
+            REQUIRE_FALSE(grandChildB.isHidden());
+            REQUIRE(root.getHierarchy().getUpdatedCount() == 0);
+            REQUIRE(root.getHierarchy().getVisibilityChangedNodes() ==
+                    vector<Node*>({&childA, &grandChildA}));
+        }
+
+        THEN("Removed and destroyed nodes must detach their subtrees")
+        {
+            REQUIRE_THROWS(root.removeChild(&grandChildA));
+            root.removeChild(&childB);
+            REQUIRE(childB.getParent() == nullptr);
+
+            {
+                Node temporary;
+                grandChildA.addChild(&temporary, mat4());
+                root.updateTransform();
+                REQUIRE(temporary.getTransformMatrix()[3] == vec4(1, 0, 1, 1));
+            }
+
+            root.updateTransform();
+            REQUIRE(root.getHierarchy().size() == 5);
+            REQUIRE(childB.getTransformMatrix()[3] == vec4(0, 1, 0, 1));
+            REQUIRE(grandChildB.getTransformMatrix()[3] == vec4(0, 1, 0, 1));
+        }
+
+        THEN("Attaching a node to its own descendant must fail")
+        {
+            REQUIRE_THROWS(grandChildA.addChild(&childA, mat4()));
+        }
+    }
+}
+
+SCENARIO("Parallel node hierarchy update test")
+{
+    GIVEN("Large hierarchies updated sequentially and in parallel")
+    {
+        ThreadPool threadPool(3);
+        Node sequentialRoot;
+        Node parallelRoot;
+        vector<unique_ptr<Node>> sequentialNodes;
+        vector<unique_ptr<Node>> parallelNodes;
+
+        auto build = [](Node& root, vector<unique_ptr<Node>>& nodes) {
+            for (size_t i = 0; i < 4000; ++i) {
+                auto& parent = i % 7 == 0 || nodes.empty() ? root : *nodes[i / 3];
+                nodes.push_back(make_unique<Node>());
+                nodes.back()->getTransform().translation = vec3(i % 5, 1, 0);
+                parent.addChild(nodes.back().get(), mat4());
+            }
+        };
+        build(sequentialRoot, sequentialNodes);
+        build(parallelRoot, parallelNodes);
+
+        sequentialRoot.updateTransform();
+        parallelRoot.updateTransform(threadPool);
+
+        THEN("Both updates must produce same world matrices")
+        {
+            REQUIRE(parallelRoot.getHierarchy().getUpdatedCount() == 4001);
+            for (size_t i = 0; i < sequentialNodes.size(); ++i) {
+                REQUIRE(sequentialNodes[i]->getTransformMatrix() ==
+                        parallelNodes[i]->getTransformMatrix());
+            }
+
+            sequentialNodes[3]->getTransform().scale = vec3(2);
+            parallelNodes[3]->getTransform().scale = vec3(2);
+            sequentialNodes[5]->setHidden(true);
+            parallelNodes[5]->setHidden(true);
+            sequentialRoot.updateTransform();
+            parallelRoot.updateTransform(threadPool);
+            REQUIRE(parallelRoot.getHierarchy().getUpdatedCount() ==
+                    sequentialRoot.getHierarchy().getUpdatedCount());
+            for (size_t i = 0; i < sequentialNodes.size(); ++i) {
+                REQUIRE(sequentialNodes[i]->getTransformMatrix() ==
+                        parallelNodes[i]->getTransformMatrix());
+                REQUIRE(sequentialNodes[i]->isHidden() == parallelNodes[i]->isHidden());
+            }
+            REQUIRE(parallelRoot.getHierarchy().getVisibilityChangedNodes().size() ==
+                    sequentialRoot.getHierarchy().getVisibilityChangedNodes().size());
+        }
+    }
+}
+
+SCENARIO("Node component change tracking test")
+{
+    GIVEN("Node components in an entity group")
+    {
+        World world;
+        auto group = world.createEntityObserver<EntityGroupWithComponents<NodeComponent>>();
+        auto nodeA = world.createEntity(1, "NodeA")->createComponent<NodeComponent>();
+        auto nodeB = world.createEntity(2, "NodeB")->createComponent<NodeComponent>();
+        world.advanceFrame();
+
+        auto countChanged = [&]() {
+            size_t changed = 0;
+            group->forEachChangedSince(world.getFrame(), [&changed](auto&) { changed++; });
+            return changed;
+        };
+
+        THEN("Modifications made through a Node reference must mark component dirty")
+        {
+            REQUIRE(countChanged() == 0);
+
+            Node& node = *nodeB;
+            node.getTransform().translation.x = 1.0f;
+            REQUIRE(nodeA->getChangeVersion() == world.getFrame() - 1);
+            REQUIRE(nodeB->getChangeVersion() == world.getFrame());
+            REQUIRE(countChanged() == 1);
+
+            world.advanceFrame();
+            static_cast<Node&>(*nodeA).setHidden(true);
+            REQUIRE(countChanged() == 1);
+            REQUIRE(nodeA->getChangeVersion() == world.getFrame());
+
+            world.advanceFrame();
+            static_cast<Node&>(*nodeA).setHidden(true);
+            REQUIRE(countChanged() == 0);
+        }
+    }
+}
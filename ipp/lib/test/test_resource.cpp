@@ -65,6 +65,18 @@ SCENARIO("Resource tests")
                         "ipp/unit_test:custom/invalid.txt"));
                 }
             }
+
+            WHEN("Requesting retained resource data")
+            {
+                auto data = resourceManager.requestResourceData("ipp/unit_test:custom/test.txt");
+                auto retainedData =
+                    resourceManager.requestResourceData("ipp/unit_test:custom/test.txt", true);
+                THEN("Retained data must match read data")
+                {
+                    REQUIRE(retainedData->getSize() == data->getSize());
+                    REQUIRE(memcmp(retainedData->getData(), data->getData(), data->getSize()) == 0);
+                }
+            }
         }
 
         GIVEN("Archive test package")
@@ -99,6 +111,18 @@ SCENARIO("Resource tests")
                         "ipp/unit_test:custom/invalid.txt"));
                 }
             }
+
+            WHEN("Requesting retained resource data")
+            {
+                auto data = resourceManager.requestResourceData("ipp/unit_test:custom/test.txt");
+                auto retainedData =
+                    resourceManager.requestResourceData("ipp/unit_test:custom/test.txt", true);
+                THEN("Retained data must match read data")
+                {
+                    REQUIRE(retainedData->getSize() == data->getSize());
+                    REQUIRE(memcmp(retainedData->getData(), data->getData(), data->getSize()) == 0);
+                }
+            }
         }
     }
 }
@@ -1,17 +1,138 @@
 #define GLFW_INCLUDE_ES2
 #include <GLFW/glfw3.h>
 #include <catch.hpp>
+#include <flatbuffers/flatbuffers.h>
 #include <ipp/context.hpp>
+#include <ipp/loop/messageloop.hpp>
 #include <ipp/resource/packagefilesystem.hpp>
+#include <ipp/resource/resourcebuffermemory.hpp>
 #include <ipp/scene/scene.hpp>
+#include <ipp/scene/animation/animationsystem.hpp>
+#include <ipp/scene/node/nodecomponent.hpp>
 #include <ipp/scene/render/rendersystem.hpp>
+#include <ipp/schema/resource/scene/scene_generated.h>
 
 using namespace std;
 using namespace ipp;
+using namespace ipp::loop;
 using namespace ipp::resource;
 using namespace ipp::scene;
+using namespace ipp::scene::animation;
+using namespace ipp::scene::node;
 using namespace ipp::scene::render;
 
+namespace sceneschema = ipp::schema::resource::scene;
+namespace primitiveschema = ipp::schema::primitive;
+
+/**
+ * @brief Serialize Scene with entityCount Node entities whose translation x is animated linearly
+ *        from 0 to 1 over 1000 milliseconds by one entity sequence each.
+ */
+vector<char> createAnimatedNodesScene(uint32_t entityCount)
+{
+    flatbuffers::FlatBufferBuilder builder;
+    primitiveschema::Mat4 identity(
+        primitiveschema::Vec4(1, 0, 0, 0), primitiveschema::Vec4(0, 1, 0, 0),
+        primitiveschema::Vec4(0, 0, 1, 0), primitiveschema::Vec4(0, 0, 0, 1));
+    sceneschema::NodeTransform transform(primitiveschema::Vec3(0, 0, 0),
+                                         primitiveschema::Vec4(0, 0, 0, 1),
+                                         sceneschema::NodeRotationMode_Quaternion,
+                                         primitiveschema::Vec3(1, 1, 1));
+    vector<sceneschema::FloatKeyFrame> keyFrames = {
+        {0, 0.0f, sceneschema::InterpolationMode_Linear, primitiveschema::Vec2(0, 0),
+         primitiveschema::Vec2(0, 0)},
+        {1000, 1.0f, sceneschema::InterpolationMode_Linear, primitiveschema::Vec2(0, 0),
+         primitiveschema::Vec2(0, 0)}};
+
+    vector<flatbuffers::Offset<sceneschema::Entity>> entities;
+    vector<flatbuffers::Offset<sceneschema::EntitySequence>> entitySequences;
+    for (uint32_t id = 1; id <= entityCount; ++id) {
+        auto node = sceneschema::CreateNodeComponent(builder, 0, &identity, &transform);
+        vector<flatbuffers::Offset<sceneschema::Component>> components = {
+            sceneschema::CreateComponent(builder, sceneschema::ComponentKind_NodeComponent,
+                                         node.Union())};
+        auto name = builder.CreateString("Node" + to_string(id));
+        entities.push_back(
+            sceneschema::CreateEntity(builder, id, name, builder.CreateVector(components)));
+
+        auto channel = sceneschema::CreateNodeTransformChannel(
+            builder, sceneschema::NodeTransformProperty_TranslationX,
+            builder.CreateVectorOfStructs(keyFrames));
+        vector<flatbuffers::Offset<sceneschema::Channel>> channels = {sceneschema::CreateChannel(
+            builder, sceneschema::ChannelKind_NodeTransformChannel, channel.Union())};
+        auto actionName = builder.CreateString("Action");
+        vector<flatbuffers::Offset<sceneschema::Action>> actions = {
+            sceneschema::CreateAction(builder, actionName, builder.CreateVector(channels))};
+
+        auto stripName = builder.CreateString("Strip");
+        vector<flatbuffers::Offset<sceneschema::Strip>> strips = {
+            sceneschema::CreateStrip(builder, stripName, 0, 1000, 0, 0, 1000)};
+        auto trackName = builder.CreateString("Track");
+        vector<flatbuffers::Offset<sceneschema::Track>> tracks = {
+            sceneschema::CreateTrack(builder, trackName, builder.CreateVector(strips))};
+
+        auto actionsVector = builder.CreateVector(actions);
+        auto tracksVector = builder.CreateVector(tracks);
+        entitySequences.push_back(
+            sceneschema::CreateEntitySequence(builder, static_cast<int32_t>(id), actionsVector,
+                                              tracksVector));
+    }
+
+    auto sceneActions = builder.CreateVector(vector<flatbuffers::Offset<sceneschema::Action>>{});
+    auto sceneTracks = builder.CreateVector(vector<flatbuffers::Offset<sceneschema::Track>>{});
+    auto sceneSequence = sceneschema::CreateSceneSequence(builder, sceneActions, sceneTracks);
+    auto entitySequencesVector = builder.CreateVector(entitySequences);
+    auto animation =
+        sceneschema::CreateAnimation(builder, 1000, sceneSequence, entitySequencesVector);
+    auto entitiesVector = builder.CreateVector(entities);
+    sceneschema::FinishSceneBuffer(builder,
+                                   sceneschema::CreateScene(builder, entitiesVector, 0, animation));
+
+    auto data = reinterpret_cast<const char*>(builder.GetBufferPointer());
+    return vector<char>(data, data + builder.GetSize());
+}
+
+/**
+ * @brief Scene of animated nodes (see createAnimatedNodesScene) counting AnimationSystem
+ *        StateUpdatedEvents.
+ */
+struct AnimatedNodesScene {
+    Context context;
+    unique_ptr<Scene> scene;
+    AnimationSystem* animationSystem;
+    size_t stateEvents;
+
+    AnimatedNodesScene(json configuration, uint32_t entityCount)
+        : context{move(configuration)}
+        , stateEvents{0}
+    {
+        auto& resourceManager = context.getResourceManager();
+        resourceManager.registerPackage(make_unique<PackageFileSystem>(
+            resourceManager, "ipp/unit_test", "resources/ipp/unit_test"));
+        scene = make_unique<Scene>(
+            context,
+            make_unique<ResourceBufferMemory>(*resourceManager.findPackage("ipp/unit_test"),
+                                              "ipp/unit_test:nodes.scene",
+                                              createAnimatedNodesScene(entityCount)));
+
+        animationSystem = scene->getMessageLoop().findSystem<AnimationSystem>();
+        scene->getMessageLoop().createListener([this](uint32_t typeId, const Event*) {
+            if (typeId == AnimationSystem::StateUpdatedEvent::GetTypeId()) {
+                stateEvents++;
+            }
+        });
+    }
+
+    /**
+     * @brief Enqueue UpdateCommand with deltaTime and update scene.
+     */
+    void update(uint32_t deltaTime)
+    {
+        scene->getMessageLoop().enqueueCommandT<AnimationSystem::UpdateCommand>(deltaTime);
+        scene->update();
+    }
+};
+
 SCENARIO("Scene loading")
 {
     GIVEN("Resource manager and test package")
@@ -31,3 +152,94 @@ SCENARIO("Scene loading")
         }
     }
 }
+
+SCENARIO("Scene animation test")
+{
+    GIVEN("Playing scene with 3 animated nodes and state events only on status change")
+    {
+        AnimatedNodesScene animatedScene(json{{"animation", {{"stateEventInterval", 1000000}}}},
+                                         3);
+        auto& scene = *animatedScene.scene;
+        auto& animationSystem = *animatedScene.animationSystem;
+        const NodeComponent* node = scene.getWorld().findEntity(1)->findComponent<NodeComponent>();
+        scene.getMessageLoop().enqueueCommandT<AnimationSystem::PlayCommand>(0, 0);
+        scene.update();
+
+        THEN("Play must evaluate scene and every entity sequence and dispatch status change")
+        {
+            REQUIRE(animationSystem.getStatus() == AnimationSystem::Status::Playing);
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 4);
+            REQUIRE(animatedScene.stateEvents == 1);
+        }
+
+        THEN("Updates that don't change time must not evaluate sequences")
+        {
+            scene.update();
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 0);
+            animatedScene.update(0);
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 0);
+            REQUIRE(animatedScene.stateEvents == 1);
+        }
+
+        THEN("Time change must evaluate every sequence once without dispatching state event")
+        {
+            animatedScene.update(100);
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 4);
+            REQUIRE(node->getTransform().translation.x == Approx(0.1f));
+            animatedScene.update(100);
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 4);
+            REQUIRE(node->getTransform().translation.x == Approx(0.2f));
+            REQUIRE(animatedScene.stateEvents == 1);
+        }
+
+        THEN("Update clamped to play end must complete and following updates must be skipped")
+        {
+            animatedScene.update(5000);
+            REQUIRE(animationSystem.getStatus() == AnimationSystem::Status::Completed);
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 4);
+            REQUIRE(node->getTransform().translation.x == Approx(1.0f));
+            REQUIRE(animatedScene.stateEvents == 2);
+
+            animatedScene.update(100);
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 0);
+            REQUIRE(animatedScene.stateEvents == 2);
+        }
+
+        THEN("Stop must dispatch status change once")
+        {
+            scene.getMessageLoop().enqueueCommandT<AnimationSystem::StopCommand>();
+            scene.update();
+            REQUIRE(animationSystem.getStatus() == AnimationSystem::Status::Stopped);
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 0);
+            REQUIRE(animatedScene.stateEvents == 2);
+
+            animatedScene.update(100);
+            REQUIRE(animationSystem.getEvaluatedSequenceCount() == 0);
+            REQUIRE(animatedScene.stateEvents == 2);
+        }
+    }
+
+    GIVEN("Playing scene with 3 animated nodes and state event on every time change")
+    {
+        AnimatedNodesScene animatedScene(json{{"animation", {{"stateEventInterval", 0}}}}, 3);
+        auto& scene = *animatedScene.scene;
+        scene.getMessageLoop().enqueueCommandT<AnimationSystem::PlayCommand>(0, 0);
+        scene.update();
+
+        THEN("State event must be dispatched once per time change")
+        {
+            REQUIRE(animatedScene.stateEvents == 1);
+            animatedScene.update(100);
+            REQUIRE(animatedScene.stateEvents == 2);
+            animatedScene.update(0);
+            scene.update();
+            REQUIRE(animatedScene.stateEvents == 2);
+            animatedScene.update(100);
+            REQUIRE(animatedScene.stateEvents == 3);
+            animatedScene.update(5000);
+            REQUIRE(animatedScene.stateEvents == 4);
+            animatedScene.update(100);
+            REQUIRE(animatedScene.stateEvents == 4);
+        }
+    }
+}
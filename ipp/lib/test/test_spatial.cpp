@@ -0,0 +1,111 @@
+#include <catch.hpp>
+#include <random>
+#include <ipp/scene/spatial/boundingvolumehierarchy.hpp>
+
+using namespace std;
+using namespace glm;
+using namespace ipp::scene::spatial;
+
+SCENARIO("Bounding volume hierarchy test")
+{
+    GIVEN("Tree with random boxes")
+    {
+        BoundingVolumeHierarchy tree(0.5f);
+        mt19937 random(42);
+        uniform_real_distribution<float> position(-100.0f, 100.0f);
+        uniform_real_distribution<float> size(0.1f, 5.0f);
+
+        auto randomBox = [&]() {
+            vec3 boxMin(position(random), position(random), position(random));
+            return BoundingBox(boxMin, boxMin + vec3(size(random), size(random), size(random)));
+        };
+
+        vector<BoundingBox> boxes;
+        vector<int32_t> proxies;
+        for (uint32_t i = 0; i < 1000; ++i) {
+            boxes.push_back(randomBox());
+            proxies.push_back(tree.createProxy(boxes.back(), i));
+        }
+
+        auto queryMatchesBruteForce = [&](const BoundingBox& query) {
+            vector<uint32_t> expected;
+            for (uint32_t i = 0; i < boxes.size(); ++i) {
+                if (proxies[i] != BoundingVolumeHierarchy::NullNode && query.overlaps(boxes[i])) {
+                    expected.push_back(i);
+                }
+            }
+
+            vector<uint32_t> found;
+            tree.query([&query](const BoundingBox& box) { return query.overlaps(box); },
+                       [&](int32_t proxy) {
+                           auto id = tree.getUserId(proxy);
+                           if (query.overlaps(boxes[id])) {
+                               found.push_back(id);
+                           }
+                           return true;
+                       });
+            sort(found.begin(), found.end());
+            return found == expected;
+        };
+
+        THEN("Tree must be balanced")
+        {
+            REQUIRE(tree.size() == 1000);
+            REQUIRE(tree.getHeight() < 20);
+        }
+
+        THEN("Box queries must match brute force after moving and removing proxies")
+        {
+            for (size_t i = 0; i < boxes.size(); i += 3) {
+                boxes[i] = randomBox();
+                tree.moveProxy(proxies[i], boxes[i]);
+            }
+            for (size_t i = 0; i < boxes.size(); i += 7) {
+                tree.destroyProxy(proxies[i]);
+                proxies[i] = BoundingVolumeHierarchy::NullNode;
+            }
+
+            for (int i = 0; i < 50; ++i) {
+                auto query = randomBox().expand(10.0f);
+                REQUIRE(queryMatchesBruteForce(query));
+            }
+        }
+
+        THEN("Small movements must not modify tree")
+        {
+            auto moved = boxes[0];
+            moved.min += vec3(0.25f);
+            moved.max += vec3(0.25f);
+            REQUIRE_FALSE(tree.moveProxy(proxies[0], moved));
+        }
+    }
+
+    GIVEN("Ray and unit box")
+    {
+        BoundingBox box(vec3(-1), vec3(1));
+
+        THEN("Ray must hit box at entry distance")
+        {
+            Ray ray{vec3(-5, 0, 0), vec3(1, 0, 0)};
+            float distance = 0;
+            REQUIRE(ray.intersect(box, 100.0f, distance));
+            REQUIRE(distance == Approx(4.0f));
+            REQUIRE_FALSE(ray.intersect(box, 3.0f, distance));
+        }
+
+        THEN("Ray pointing away must miss box")
+        {
+            Ray ray{vec3(-5, 0, 0), vec3(-1, 0, 0)};
+            float distance = 0;
+            REQUIRE_FALSE(ray.intersect(box, 100.0f, distance));
+        }
+
+        THEN("Transformed box must contain transformed corners")
+        {
+            auto transformed = box.transform(translate(vec3(10, 0, 0)) * scale(vec3(2)));
+            REQUIRE(transformed.min.x == Approx(8.0f));
+            REQUIRE(transformed.max.x == Approx(12.0f));
+            REQUIRE(transformed.max.z == Approx(2.0f));
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#include <catch.hpp>
+#include <ipp/task/threadpool.hpp>
+#include <ipp/task/taskgraph.hpp>
+#include <ipp/task/parallelfor.hpp>
+
+using namespace std;
+using namespace ipp::task;
+
+SCENARIO("Task system")
+{
+    GIVEN("Serial thread pool")
+    {
+        ThreadPool pool{0};
+
+        THEN("Tasks must execute in submission order on calling thread")
+        {
+            vector<int> order;
+            TaskGroup group;
+            for (int i = 0; i < 10; ++i) {
+                pool.submit(group, [&order, i]() { order.push_back(i); });
+            }
+            pool.wait(group);
+
+            REQUIRE(order.size() == 10);
+            REQUIRE(is_sorted(order.begin(), order.end()));
+        }
+
+        THEN("Parallel for must process the whole range on calling thread")
+        {
+            vector<pair<size_t, size_t>> chunks;
+            parallelFor(pool, 0, 100, 10,
+                        [&chunks](size_t begin, size_t end) { chunks.emplace_back(begin, end); });
+            REQUIRE(chunks.size() == 1);
+            REQUIRE(chunks[0] == make_pair<size_t, size_t>(0, 100));
+        }
+    }
+
+    GIVEN("Thread pool with workers")
+    {
+        ThreadPool pool{3};
+
+        THEN("Parallel for must visit every element exactly once")
+        {
+            vector<int> values(10000, 0);
+            parallelForEach(pool, values, 64, [](int& value) { value++; });
+            REQUIRE(count(values.begin(), values.end(), 1) == 10000);
+        }
+
+        THEN("Nested parallel for must complete")
+        {
+            atomic<size_t> visited{0};
+            parallelFor(pool, 0, 16, 1, [&](size_t, size_t) {
+                parallelFor(pool, 0, 100, 10, [&](size_t begin, size_t end) {
+                    visited.fetch_add(end - begin);
+                });
+            });
+            REQUIRE(visited == 1600);
+        }
+
+        THEN("Task exceptions must be rethrown by wait")
+        {
+            TaskGroup group;
+            pool.submit(group, []() { throw runtime_error("task failed"); });
+            REQUIRE_THROWS_AS(pool.wait(group), runtime_error);
+        }
+    }
+
+    GIVEN("Task graph")
+    {
+        TaskGraph graph;
+        mutex orderMutex;
+        vector<int> order;
+        auto record = [&](int value) {
+            return [&, value]() {
+                lock_guard<mutex> lock(orderMutex);
+                order.push_back(value);
+            };
+        };
+
+        auto a = graph.addTask(record(0));
+        auto b = graph.addTask(record(1));
+        auto c = graph.addTask(record(2));
+        auto d = graph.addTask(record(3));
+        graph.addDependency(a, c);
+        graph.addDependency(b, a);
+        graph.addDependency(d, b);
+        graph.addDependency(d, c);
+
+        THEN("Tasks must execute after their dependencies")
+        {
+            ThreadPool pool{2};
+            for (int run = 0; run < 10; ++run) {
+                order.clear();
+                graph.run(pool);
+                REQUIRE(order == vector<int>({2, 0, 1, 3}));
+            }
+        }
+
+        THEN("Graph with a cycle must fail to run")
+        {
+            ThreadPool pool{0};
+            graph.addDependency(c, d);
+            REQUIRE_THROWS(graph.run(pool));
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #include <catch.hpp>
 #include <ipp/entity/world.hpp>
 #include <ipp/entity/entitygroup.hpp>
+#include <ipp/entity/worldsnapshot.hpp>
+#include <thread>
 
 using namespace std;
 using namespace ipp::entity;
@@ -59,6 +61,35 @@ const string ComponentB::ComponentTypeName = "DummyComponentB";
 template <>
 const string ComponentC::ComponentTypeName = "DummyComponentC";
 
+class StateComponent final : public ComponentT<StateComponent> {
+public:
+    StateComponent(Entity& entity)
+        : ComponentT<StateComponent>(entity)
+        , value{0}
+    {
+    }
+
+    size_t getSnapshotSize() const override
+    {
+        return sizeof(value);
+    }
+
+    void writeSnapshot(uint8_t* buffer) const override
+    {
+        memcpy(buffer, &value, sizeof(value));
+    }
+
+    void readSnapshot(const uint8_t* buffer) override
+    {
+        memcpy(&value, buffer, sizeof(value));
+    }
+
+    int value;
+    static const string ComponentTypeName;
+};
+
+const string StateComponent::ComponentTypeName = "StateComponent";
+
 typedef DummyComponentGroup<1> GroupA;
 typedef DummyComponentGroup<2> GroupB;
 typedef DummyComponentGroup<3> GroupC;
@@ -108,6 +139,99 @@ SCENARIO("World test")
                 REQUIRE_THROWS(world.createEntity(100, "EntityC"));
             }
 
+            THEN("Removing an Entity must not invalidate other Entity references")
+            {
+                REQUIRE(world.removeEntity(2));
+                REQUIRE_FALSE(world.removeEntity(2));
+                REQUIRE(world.findEntity(2) == nullptr);
+                REQUIRE(world.findEntity(1) == entityA);
+                REQUIRE(world.findEntity(3) == entityC);
+                REQUIRE(world.getEntities().size() == 2);
+
+                auto entityD = world.createEntity(2, "EntityD");
+                REQUIRE(world.findEntity(2) == entityD);
+                REQUIRE(world.findEntity("EntityD") == entityD);
+                REQUIRE(world.getEntities().size() == 3);
+            }
+
+            THEN("Deferred commands must only be applied when command buffers are applied")
+            {
+                world.getCommandBuffer().createEntity(4, "EntityD");
+                world.getCommandBuffer().createComponent<ComponentA>(4);
+                world.getCommandBuffer().removeEntity(2);
+
+                thread worker([&world]() {
+                    auto& commandBuffer = world.getCommandBuffer();
+                    commandBuffer.createComponent<ComponentB>(3);
+                    commandBuffer.removeComponent<ComponentC>(3);
+                });
+                worker.join();
+
+                REQUIRE(world.findEntity(4) == nullptr);
+                REQUIRE(world.findEntity(2) == entityB);
+
+                world.applyCommandBuffers();
+                REQUIRE(world.findEntity(4)->findComponent<ComponentA>() != nullptr);
+                REQUIRE(world.findEntity(2) == nullptr);
+                REQUIRE(entityC->findComponent<ComponentB>() != nullptr);
+                REQUIRE(world.getCommandBuffer().isEmpty());
+            }
+
+            THEN("Deferred commands of different threads must be applied in recording order")
+            {
+                // worker thread buffer is created first but records its command last
+                EntityCommandBuffer* workerCommandBuffer = nullptr;
+                thread([&world, &workerCommandBuffer]() {
+                    workerCommandBuffer = &world.getCommandBuffer();
+                }).join();
+                auto& mainCommandBuffer = world.getCommandBuffer();
+                mainCommandBuffer.createEntity(4, "EntityD");
+                workerCommandBuffer->removeEntity(4);
+                mainCommandBuffer.createComponent<ComponentA>(3);
+                workerCommandBuffer->removeComponent<ComponentA>(3);
+
+                world.applyCommandBuffers();
+                REQUIRE(world.findEntity(4) == nullptr);
+                REQUIRE(entityC->findComponent<ComponentA>() == nullptr);
+                REQUIRE(workerCommandBuffer->isEmpty());
+            }
+
+            THEN("Failing deferred commands must not discard remaining commands")
+            {
+                world.getCommandBuffer().createEntity(1, "EntityDuplicate");
+                world.getCommandBuffer().createEntity(4, "EntityD");
+                world.getCommandBuffer().createComponent<ComponentA>(4);
+
+                world.applyCommandBuffers();
+                REQUIRE(world.findEntity(1) == entityA);
+                REQUIRE(world.findEntity(4)->findComponent<ComponentA>() != nullptr);
+                REQUIRE(world.getCommandBuffer().isEmpty());
+            }
+
+            THEN("Restoring a snapshot must restore component state")
+            {
+                auto stateA = entityA->createComponent<StateComponent>();
+                auto stateC = entityC->createComponent<StateComponent>();
+                stateA->value = 1;
+                stateC->value = 3;
+
+                WorldSnapshot snapshot;
+                snapshot.capture(world);
+                REQUIRE(snapshot.getSize() == 2 * sizeof(int));
+
+                stateA->value = 10;
+                stateC->value = 30;
+                world.advanceFrame();
+                snapshot.restore(world);
+                REQUIRE(stateA->value == 1);
+                REQUIRE(stateC->value == 3);
+                REQUIRE(stateC->getChangeVersion() == world.getFrame());
+
+                entityB->createComponent<StateComponent>();
+                REQUIRE_FALSE(snapshot.isValidFor(world));
+                REQUIRE_THROWS(snapshot.restore(world));
+            }
+
             THEN("Querying for nonexisting components must return nullptr")
             {
                 REQUIRE(entityA->findComponent<ComponentA>() == nullptr);
@@ -128,12 +252,48 @@ SCENARIO("World test")
                     REQUIRE_THROWS(entityA->createComponent<ComponentA>());
                 }
 
+                THEN("Removed component slots must be reused by component pool")
+                {
+                    auto& pool = world.getComponentPool<ComponentB>();
+                    REQUIRE(pool.getStatistics().liveCount == 1);
+                    REQUIRE(pool.getStatistics().capacity == ComponentPoolT<ComponentB>::SlabSize);
+
+                    auto componentAB = entityA->createComponent<ComponentB>();
+                    REQUIRE(pool.getStatistics().liveCount == 2);
+
+                    entityA->removeComponent(componentAB);
+                    REQUIRE(pool.getStatistics().liveCount == 1);
+                    REQUIRE(entityC->createComponent<ComponentB>() == componentAB);
+
+                    REQUIRE(world.removeEntity(2));
+                    REQUIRE(pool.getStatistics().liveCount == 1);
+                    REQUIRE(world.getComponentPoolStatistics().size() == 3);
+                }
+
                 GIVEN("Entity groups")
                 {
                     auto groupA = world.createEntityObserver<GroupA>();
                     auto groupB = world.createEntityObserver<GroupB>();
                     auto groupC = world.createEntityObserver<GroupC>();
 
+                    THEN("Only components marked dirty must be iterated as changed")
+                    {
+                        auto frame = world.getFrame();
+                        world.advanceFrame();
+
+                        size_t changed = 0;
+                        groupB->forEachChangedSince(world.getFrame(),
+                                                    [&changed](auto&) { changed++; });
+                        REQUIRE(changed == 0);
+
+                        componentB->markDirty();
+                        REQUIRE(componentA->getChangeVersion() == frame);
+                        REQUIRE(componentB->getChangeVersion() == frame + 1);
+                        groupB->forEachChangedSince(world.getFrame(),
+                                                    [&changed](auto&) { changed++; });
+                        REQUIRE(changed == 1);
+                    }
+
                     THEN("Entities/components must be registered in coresponding groups")
                     {
                         REQUIRE(groupA->matchingComponents.size() == 1);
@@ -3,6 +3,7 @@ import bmesh
 from io import BytesIO
 from struct import Struct, pack
 from mathutils import Vector
+from ipp.schema.primitive.Vec3 import CreateVec3
 from ipp.schema.resource.render.mesh import Mesh, VertexBuffer
 from ipp.schema.resource.render.vertex import AttributeDefinition
 from ipp.schema.resource.render.vertex.ElementType import ElementType
@@ -35,6 +36,8 @@ class VertexBuilder:
 
         self.vertex_struct = Struct(format_definition)
         self.vertices = BytesIO()
+        self.bounds_min = None
+        self.bounds_max = None
 
         self.attributes = [(AttributeName.Position, 0, ElementType.Float, 3, False)]
 
@@ -132,6 +135,15 @@ class VertexBuilder:
                     vertex_data.append(group_weight)
                 args_offset += 1
 
+        # grow position bounds
+        if self.bounds_min is None:
+            self.bounds_min = [co[0], co[1], co[2]]
+            self.bounds_max = [co[0], co[1], co[2]]
+        else:
+            for i in range(0, 3):
+                self.bounds_min[i] = min(self.bounds_min[i], co[i])
+                self.bounds_max[i] = max(self.bounds_max[i], co[i])
+
         # pack using vertex struct
         self.vertices.write(
             self.vertex_struct.pack(
@@ -169,6 +181,9 @@ def compile_mesh(builder, vertex_builder, indices):
     Mesh.MeshAddVertices(builder, vertices_table)
     Mesh.MeshAddIndices(builder, indices_vector)
     Mesh.MeshAddTriangleCount(builder, len(indices) // 3)
+    if vertex_builder.bounds_min is not None:
+        Mesh.MeshAddBoundsMin(builder, CreateVec3(builder, *vertex_builder.bounds_min))
+        Mesh.MeshAddBoundsMax(builder, CreateVec3(builder, *vertex_builder.bounds_max))
 
     return Mesh.MeshEnd(builder)
 
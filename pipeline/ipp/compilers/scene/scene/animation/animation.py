@@ -13,6 +13,13 @@ class AnimationBuilder:
         # scene export FPS used to convert from scene frame to scene time
         self.fps = scene_builder.bl_scene.render.fps
 
+        # merge transform fcurves with matching keyframe times in to packed vector channels
+        self.pack_channels = scene_builder.scene_definition.get('pack_animation_channels', True)
+
+        # resample transform and bone pose channels at scene frame rate with quantized values,
+        # keyframe channels are exported otherwise
+        self.resample_channels = scene_builder.scene_definition.get('resample_animation', False)
+
         # scene duration
         self.sequence_duration = self.frames_to_milliseconds(scene_builder.bl_scene.frame_end)
 
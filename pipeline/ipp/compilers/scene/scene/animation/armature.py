@@ -2,6 +2,9 @@ from ipp.schema.resource.scene.BonePoseKeyFrame import *
 from ipp.schema.resource.scene.BonePoseChannel import *
 from ipp.schema.resource.scene.Channel import *
 from ipp.schema.resource.scene.ChannelKind import *
+from ipp.schema.resource.scene.SampledBonePoseChannel import *
+from ipp.schema.primitive.Vec4 import CreateVec4
+from .quantize import quantize_range, quantize_rotation
 
 
 class BonePoseChannelBuilder:
@@ -24,3 +27,47 @@ class BonePoseChannelBuilder:
         ChannelAddChannel(builder, channel_data_offset)
         ChannelAddChannelType(builder, ChannelKind.BonePoseChannel)
         return ChannelEnd(builder)
+
+
+class SampledBonePoseChannelBuilder:
+    """
+    Bone pose channel with poses sampled at a fixed rate, translation and scale are quantized to
+    16 bits per component and rotation is smallest three encoded.
+
+    Poses are (translation x, y, z, rotation x, y, z, w, scale) tuples.
+    """
+    def __init__(self, bone_index, start_time, sample_rate, poses):
+        self.bone_index = bone_index
+        self.start_time = start_time
+        self.sample_rate = sample_rate
+
+        translation_scales = [pose[0:3] + pose[7:8] for pose in poses]
+        self.range_min, self.range_extent, self.translation_scales = \
+            quantize_range(translation_scales, 4)
+        self.rotations = [value for pose in poses for value in quantize_rotation(*pose[3:7])]
+
+    def build(self, builder):
+        SampledBonePoseChannelStartTranslationScalesVector(builder, len(self.translation_scales))
+        for value in reversed(self.translation_scales):
+            builder.PrependUint16(value)
+        translation_scales_vector = builder.EndVector(len(self.translation_scales))
+
+        SampledBonePoseChannelStartRotationsVector(builder, len(self.rotations))
+        for value in reversed(self.rotations):
+            builder.PrependUint16(value)
+        rotations_vector = builder.EndVector(len(self.rotations))
+
+        SampledBonePoseChannelStart(builder)
+        SampledBonePoseChannelAddBone(builder, self.bone_index)
+        SampledBonePoseChannelAddStartTime(builder, self.start_time)
+        SampledBonePoseChannelAddSampleRate(builder, self.sample_rate)
+        SampledBonePoseChannelAddRangeMin(builder, CreateVec4(builder, *self.range_min))
+        SampledBonePoseChannelAddRangeExtent(builder, CreateVec4(builder, *self.range_extent))
+        SampledBonePoseChannelAddTranslationScales(builder, translation_scales_vector)
+        SampledBonePoseChannelAddRotations(builder, rotations_vector)
+        channel_data_offset = SampledBonePoseChannelEnd(builder)
+
+        ChannelStart(builder)
+        ChannelAddChannel(builder, channel_data_offset)
+        ChannelAddChannelType(builder, ChannelKind.SampledBonePoseChannel)
+        return ChannelEnd(builder)
@@ -4,14 +4,20 @@ from ipp.schema.resource.scene.InterpolationMode import *
 from ipp.compilers.render.armature import ArmatureBuilder, uniform_scale
 from .action import ActionBuilder
 from .track import TrackBuilder
-from .armature import BonePoseChannelBuilder
+from .armature import BonePoseChannelBuilder, SampledBonePoseChannelBuilder
 from .node import NodeHiddenChannelBuilder, NodeTransformChannelBuilder, \
-    interpolation_map, data_path_transform_property_map
+    NodeTransformVectorChannelBuilder, SampledNodeTransformChannelBuilder, \
+    can_pack_transform_components, \
+    interpolation_map, data_path_transform_property_map, data_path_vector_property_map
 
 
 def build_entity_action(animation_builder, index, bl_action, bl_armature):
     channels = []
     action_contains_poses = False
+    # transform fcurve (array_index, keyframes) components by data path
+    transform_components = {}
+    # transform fcurves by data path, evaluated per frame when resampling
+    transform_fcurves = {}
 
     # export recognized fcurves from blender action to channels
     for bl_fcurve in bl_action.fcurves:
@@ -35,7 +41,6 @@ def build_entity_action(animation_builder, index, bl_action, bl_armature):
         else:
             transform_property_map = data_path_transform_property_map.get(bl_fcurve.data_path, None)
             if transform_property_map:
-                transform_property = transform_property_map[bl_fcurve.array_index]
                 keyframes = []
                 for bl_keyframe in bl_fcurve.keyframe_points:
                     time = animation_builder.frames_to_milliseconds(bl_keyframe.co[0])
@@ -56,12 +61,41 @@ def build_entity_action(animation_builder, index, bl_action, bl_armature):
                             bl_keyframe.handle_right[1]))
                     else:
                         keyframes.append((time, value, interpolation, 0, 0, 0, 0))
-                channels.append(NodeTransformChannelBuilder(transform_property, keyframes))
+                transform_components.setdefault(bl_fcurve.data_path, []).append(
+                    (bl_fcurve.array_index, keyframes))
+                transform_fcurves.setdefault(bl_fcurve.data_path, []).append(bl_fcurve)
                 continue
 
             log.debug("Found unrecognized FCurve %s in Blender Action %s, skipping.",
                       bl_fcurve.data_path, bl_action.name)
 
+    action_start = int(bl_action.frame_range[0])
+    action_end = int(bl_action.frame_range[1])
+
+    # resample transform properties at scene frame rate in to fixed rate quantized channels
+    if animation_builder.resample_channels:
+        for data_path, bl_fcurves in transform_fcurves.items():
+            samples = [tuple(bl_fcurve.evaluate(frame) for bl_fcurve in bl_fcurves)
+                       for frame in range(action_start, action_end + 1)]
+            channels.append(SampledNodeTransformChannelBuilder(
+                data_path_vector_property_map[data_path],
+                [bl_fcurve.array_index for bl_fcurve in bl_fcurves],
+                animation_builder.frames_to_milliseconds(action_start),
+                animation_builder.fps,
+                samples))
+        transform_components = {}
+
+    # pack components of the same transform property to a single channel when keyframes match
+    for data_path, components in transform_components.items():
+        if animation_builder.pack_channels and can_pack_transform_components(components):
+            channels.append(NodeTransformVectorChannelBuilder(
+                data_path_vector_property_map[data_path], components))
+            continue
+        transform_property_map = data_path_transform_property_map[data_path]
+        for array_index, keyframes in components:
+            channels.append(NodeTransformChannelBuilder(
+                transform_property_map[array_index], keyframes))
+
     # exporting armature bone channels requires a different approach from fcurve channel
     # need to go trough every scene frame and sample bone values at each frame
     if bl_armature and action_contains_poses:
@@ -86,8 +120,6 @@ def build_entity_action(animation_builder, index, bl_action, bl_armature):
                 for bl_bone in bl_armature.pose.bones
                 if bl_bone.name in bone_index_map}
 
-            action_start = int(bl_action.frame_range[0])
-            action_end = int(bl_action.frame_range[1])
             for frame in range(action_start, action_end):
                 animation_builder.bl_scene.frame_set(frame)
                 for bl_bone, keyframes in bone_keyframes.items():
@@ -104,7 +136,16 @@ def build_entity_action(animation_builder, index, bl_action, bl_armature):
                         uniform_scale(scale)))
 
             for bl_bone, keyframes in bone_keyframes.items():
-                channels.append(BonePoseChannelBuilder(bone_index_map[bl_bone.name], keyframes))
+                if animation_builder.resample_channels:
+                    # keyframes are already sampled every frame, only drop times
+                    channels.append(SampledBonePoseChannelBuilder(
+                        bone_index_map[bl_bone.name],
+                        animation_builder.frames_to_milliseconds(action_start),
+                        animation_builder.fps,
+                        [keyframe[1:] for keyframe in keyframes]))
+                else:
+                    channels.append(BonePoseChannelBuilder(
+                        bone_index_map[bl_bone.name], keyframes))
 
         finally:
             # restore frame/action state
@@ -5,7 +5,12 @@ from ipp.schema.resource.scene.FloatKeyFrame import *
 from ipp.schema.resource.scene.NodeHiddenChannel import *
 from ipp.schema.resource.scene.NodeTransformProperty import *
 from ipp.schema.resource.scene.NodeTransformChannel import *
+from ipp.schema.resource.scene.NodeTransformVectorProperty import *
+from ipp.schema.resource.scene.NodeTransformVectorChannel import *
+from ipp.schema.resource.scene.SampledNodeTransformChannel import *
 from ipp.schema.resource.scene.InterpolationMode import *
+from ipp.schema.primitive.Vec4 import CreateVec4
+from .quantize import quantize_range
 
 
 class NodeHiddenChannelBuilder:
@@ -50,6 +55,131 @@ class NodeTransformChannelBuilder:
         return ChannelEnd(builder)
 
 
+class NodeTransformVectorChannelBuilder:
+    """
+    Packed channel animating multiple components of a transform vector property.
+
+    Components are (array_index, keyframes) pairs with matching keyframe times and interpolation
+    modes, see can_pack_transform_components.
+    """
+    def __init__(self, vector_property, components):
+        self.vector_property = vector_property
+        self.component_mask = 0
+        for array_index, _ in components:
+            self.component_mask |= 1 << array_index
+
+        reference = components[0][1]
+        self.times = [keyframe[0] for keyframe in reference]
+        self.interpolation_modes = [keyframe[2] for keyframe in reference]
+        self.values = [0.0] * (4 * len(reference))
+        for array_index, keyframes in components:
+            for index, keyframe in enumerate(keyframes):
+                self.values[index * 4 + array_index] = keyframe[1]
+
+    def build(self, builder):
+        NodeTransformVectorChannelStartTimesVector(builder, len(self.times))
+        for time in reversed(self.times):
+            builder.PrependInt32(time)
+        times_vector = builder.EndVector(len(self.times))
+
+        NodeTransformVectorChannelStartValuesVector(builder, len(self.values))
+        for value in reversed(self.values):
+            builder.PrependFloat32(value)
+        values_vector = builder.EndVector(len(self.values))
+
+        NodeTransformVectorChannelStartInterpolationModesVector(builder, len(self.interpolation_modes))
+        for interpolation_mode in reversed(self.interpolation_modes):
+            builder.PrependInt32(interpolation_mode)
+        interpolation_modes_vector = builder.EndVector(len(self.interpolation_modes))
+
+        NodeTransformVectorChannelStart(builder)
+        NodeTransformVectorChannelAddProperty(builder, self.vector_property)
+        NodeTransformVectorChannelAddComponentMask(builder, self.component_mask)
+        NodeTransformVectorChannelAddTimes(builder, times_vector)
+        NodeTransformVectorChannelAddValues(builder, values_vector)
+        NodeTransformVectorChannelAddInterpolationModes(builder, interpolation_modes_vector)
+        channel_data_offset = NodeTransformVectorChannelEnd(builder)
+
+        ChannelStart(builder)
+        ChannelAddChannel(builder, channel_data_offset)
+        ChannelAddChannelType(builder, ChannelKind.NodeTransformVectorChannel)
+        return ChannelEnd(builder)
+
+
+class SampledNodeTransformChannelBuilder:
+    """
+    Channel animating components of a transform vector property with values sampled at a fixed
+    rate and quantized to 16 bits per component.
+
+    Samples contain a value per component in array_indices for every sample.
+    """
+    def __init__(self, vector_property, array_indices, start_time, sample_rate, samples):
+        self.vector_property = vector_property
+        self.component_mask = 0
+        for array_index in array_indices:
+            self.component_mask |= 1 << array_index
+        self.start_time = start_time
+        self.sample_rate = sample_rate
+
+        component_range_min, component_range_extent, self.samples = \
+            quantize_range(samples, len(array_indices))
+        self.range_min = [0.0] * 4
+        self.range_extent = [0.0] * 4
+        for component, array_index in enumerate(array_indices):
+            self.range_min[array_index] = component_range_min[component]
+            self.range_extent[array_index] = component_range_extent[component]
+
+    def build(self, builder):
+        SampledNodeTransformChannelStartSamplesVector(builder, len(self.samples))
+        for sample in reversed(self.samples):
+            builder.PrependUint16(sample)
+        samples_vector = builder.EndVector(len(self.samples))
+
+        SampledNodeTransformChannelStart(builder)
+        SampledNodeTransformChannelAddProperty(builder, self.vector_property)
+        SampledNodeTransformChannelAddComponentMask(builder, self.component_mask)
+        SampledNodeTransformChannelAddStartTime(builder, self.start_time)
+        SampledNodeTransformChannelAddSampleRate(builder, self.sample_rate)
+        SampledNodeTransformChannelAddRangeMin(builder, CreateVec4(builder, *self.range_min))
+        SampledNodeTransformChannelAddRangeExtent(builder, CreateVec4(builder, *self.range_extent))
+        SampledNodeTransformChannelAddSamples(builder, samples_vector)
+        channel_data_offset = SampledNodeTransformChannelEnd(builder)
+
+        ChannelStart(builder)
+        ChannelAddChannel(builder, channel_data_offset)
+        ChannelAddChannelType(builder, ChannelKind.SampledNodeTransformChannel)
+        return ChannelEnd(builder)
+
+
+def can_pack_transform_components(components):
+    """
+    Check if (array_index, keyframes) components can be packed in to a single vector channel.
+    """
+    if len(components) < 2:
+        return False
+    if len({array_index for array_index, _ in components}) != len(components):
+        return False
+
+    reference = components[0][1]
+    for _, keyframes in components:
+        if len(keyframes) != len(reference):
+            return False
+        for keyframe, reference_keyframe in zip(keyframes, reference):
+            if keyframe[2] == InterpolationMode.Bezier:
+                return False
+            if keyframe[0] != reference_keyframe[0] or keyframe[2] != reference_keyframe[2]:
+                return False
+    return True
+
+
+data_path_vector_property_map = {
+    'location': NodeTransformVectorProperty.Translation,
+    'rotation_euler': NodeTransformVectorProperty.RotationEuler,
+    'rotation_axis_angle': NodeTransformVectorProperty.RotationAxisAngle,
+    'rotation_quaternion': NodeTransformVectorProperty.RotationQuaternion,
+    'scale': NodeTransformVectorProperty.Scale}
+
+
 data_path_transform_property_map = {
     'location': (
         NodeTransformProperty.TranslationX,
@@ -71,8 +201,8 @@ data_path_transform_property_map = {
         NodeTransformProperty.RotationQuaternionW),
     'scale': (
         NodeTransformProperty.ScaleX,
-        NodeTransformProperty.ScaleX,
-        NodeTransformProperty.ScaleX)}
+        NodeTransformProperty.ScaleY,
+        NodeTransformProperty.ScaleZ)}
 
 
 interpolation_map = {
@@ -0,0 +1,57 @@
+import math
+
+
+# largest quantized value of a 16 bit range quantized component
+QUANTIZED_MAX = 65535
+# largest quantized value of a smallest three quaternion component, top bit stores largest index
+ROTATION_QUANTIZED_MAX = 32767
+# smallest three quaternion components are in [-ROTATION_RANGE, ROTATION_RANGE]
+ROTATION_RANGE = 1 / math.sqrt(2)
+
+
+def quantize_range(samples, component_count):
+    """
+    Quantize sample tuples to 16 bit values over per component range.
+
+    Returns (range_min, range_extent, quantized) with quantized containing component_count values
+    per sample.
+    """
+    range_min = [0.0] * component_count
+    range_extent = [0.0] * component_count
+    if samples:
+        for component in range(component_count):
+            values = [sample[component] for sample in samples]
+            range_min[component] = min(values)
+            range_extent[component] = max(values) - range_min[component]
+
+    quantized = []
+    for sample in samples:
+        for component in range(component_count):
+            if range_extent[component] <= 0:
+                quantized.append(0)
+                continue
+            normalized = (sample[component] - range_min[component]) / range_extent[component]
+            quantized.append(int(round(min(1.0, max(0.0, normalized)) * QUANTIZED_MAX)))
+    return range_min, range_extent, quantized
+
+
+def quantize_rotation(x, y, z, w):
+    """
+    Compress quaternion to 3 values with smallest three encoding (matches
+    QuantizedPoseSamples::QuantizeRotation).
+    """
+    length = math.sqrt(x * x + y * y + z * z + w * w)
+    components = [x / length, y / length, z / length, w / length]
+    largest = max(range(4), key=lambda index: abs(components[index]))
+    sign = -1.0 if components[largest] < 0 else 1.0
+
+    quantized = []
+    for index, component in enumerate(components):
+        if index == largest:
+            continue
+        normalized = (sign * component / ROTATION_RANGE) * 0.5 + 0.5
+        quantized.append(int(round(min(1.0, max(0.0, normalized)) * ROTATION_QUANTIZED_MAX)))
+
+    quantized[0] |= (largest & 1) << 15
+    quantized[1] |= (largest >> 1) << 15
+    return quantized
@@ -15,6 +15,12 @@ def build_scene(manifest, resource_path, scene_definition):
         # use global object_filter if not specified in build manifest
         if 'object_filter' not in scene_definition and 'object_filter' in scene_globals:
             scene_definition['object_filter'] = scene_globals['object_filter']
+        # use global pack_animation_channels if not specified in build manifest
+        if 'pack_animation_channels' not in scene_definition and 'pack_animation_channels' in scene_globals:
+            scene_definition['pack_animation_channels'] = scene_globals['pack_animation_channels']
+        # use global resample_animation if not specified in build manifest
+        if 'resample_animation' not in scene_definition and 'resample_animation' in scene_globals:
+            scene_definition['resample_animation'] = scene_globals['resample_animation']
 
     open_blend(scene_definition['source']['blend'])
 